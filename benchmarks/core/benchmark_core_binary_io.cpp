@@ -0,0 +1,119 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_data.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/io/binary_io.hpp"
+#include "vecmem/io/mapped_file.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+namespace {
+
+   /// Memory resource used in the benchmarks
+   vecmem::host_memory_resource host_resource;
+
+   /// Create a jagged vector with the requested number of rows
+   vecmem::jagged_vector< float > make_jagged( std::size_t rows ) {
+
+      vecmem::jagged_vector< float > result( &host_resource );
+      result.reserve( rows );
+      for( std::size_t i = 0; i < rows; ++i ) {
+         result.push_back( vecmem::vector< float >( i % 32, 1.5f * i,
+                                                    &host_resource ) );
+      }
+      return result;
+   }
+
+   /// Name of the temporary file used by the benchmarks
+   const std::string file_name = "vecmem_benchmark_binary_io.bin";
+
+} // private namespace
+
+/// Write/read a jagged vector with formatted, element-by-element I/O
+static void naive_iostream_jagged( benchmark::State& state ) {
+
+   const vecmem::jagged_vector< float > input =
+      ::make_jagged( state.range( 0 ) );
+   for( auto _ : state ) {
+      // Write the data element by element.
+      std::stringstream stream;
+      stream << input.size() << ' ';
+      for( const vecmem::vector< float >& row : input ) {
+         stream << row.size() << ' ';
+         for( float value : row ) {
+            stream << value << ' ';
+         }
+      }
+      // Read it back in the same way.
+      std::size_t rows = 0;
+      stream >> rows;
+      vecmem::jagged_vector< float > output( rows, &host_resource );
+      for( vecmem::vector< float >& row : output ) {
+         std::size_t size = 0;
+         stream >> size;
+         row.resize( size );
+         for( float& value : row ) {
+            stream >> value;
+         }
+      }
+      benchmark::DoNotOptimize( output.data() );
+   }
+}
+BENCHMARK( naive_iostream_jagged )->Range( 1 << 10, 1 << 16 );
+
+/// Write/read a jagged vector with the vecmem binary format
+static void binary_stream_jagged( benchmark::State& state ) {
+
+   vecmem::jagged_vector< float > input = ::make_jagged( state.range( 0 ) );
+   vecmem::data::jagged_vector_data< float > data( input );
+   for( auto _ : state ) {
+      std::stringstream stream;
+      vecmem::io::write_binary( stream, data );
+      auto output = vecmem::io::read_binary_jagged_vector< float >(
+         stream, host_resource );
+      benchmark::DoNotOptimize( output.m_ptr );
+   }
+}
+BENCHMARK( binary_stream_jagged )->Range( 1 << 10, 1 << 16 );
+
+/// Access a jagged vector through a memory mapped file
+static void binary_mapped_jagged( benchmark::State& state ) {
+
+   // Write the file once.
+   {
+      vecmem::jagged_vector< float > input = ::make_jagged( state.range( 0 ) );
+      vecmem::data::jagged_vector_data< float > data( input );
+      std::ofstream out( ::file_name, std::ios::binary );
+      vecmem::io::write_binary( out, data );
+   }
+   // Map it, and sum up all of its elements.
+   for( auto _ : state ) {
+      vecmem::io::mapped_file file( ::file_name );
+      auto view = file.jagged_view< float >( host_resource );
+      float sum = 0.f;
+      for( std::size_t i = 0; i < view.m_size; ++i ) {
+         sum = std::accumulate( view.m_ptr[ i ].m_ptr,
+                                view.m_ptr[ i ].m_ptr + view.m_ptr[ i ].m_size,
+                                sum );
+      }
+      benchmark::DoNotOptimize( sum );
+   }
+   std::remove( ::file_name.c_str() );
+}
+BENCHMARK( binary_mapped_jagged )->Range( 1 << 10, 1 << 16 );
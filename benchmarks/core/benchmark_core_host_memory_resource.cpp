@@ -0,0 +1,79 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstddef>
+
+// The "uncached" benchmarks measure the system allocator itself. Different
+// allocators (jemalloc, mimalloc, etc.) can be compared by running this
+// executable with the allocator's library set in LD_PRELOAD.
+
+namespace {
+
+   /// Get a host memory resource with or without its cache
+   vecmem::host_memory_resource& get_resource( bool use_cache ) {
+
+      static vecmem::host_memory_resource cached( true );
+      static vecmem::host_memory_resource uncached( false );
+      return ( use_cache ? cached : uncached );
+   }
+
+} // private namespace
+
+/// Create, fill and destroy small vectors, like the ones of hit clusters
+static void host_resource_small_vectors( benchmark::State& state ) {
+
+   vecmem::host_memory_resource& resource = get_resource( state.range( 0 ) );
+   for( auto _ : state ) {
+      for( int cluster = 0; cluster < 100; ++cluster ) {
+         vecmem::vector< float > vec( &resource );
+         for( int i = 0; i < ( cluster % 20 ) + 1; ++i ) {
+            vec.push_back( static_cast< float >( i ) );
+         }
+         benchmark::DoNotOptimize( vec.data() );
+      }
+   }
+}
+BENCHMARK( host_resource_small_vectors )->ArgName( "cache" )->Arg( 0 )
+   ->Arg( 1 );
+
+/// Build and destroy a jagged vector of small inner vectors
+static void host_resource_jagged_vector( benchmark::State& state ) {
+
+   vecmem::host_memory_resource& resource = get_resource( state.range( 0 ) );
+   for( auto _ : state ) {
+      vecmem::jagged_vector< int > jagged( &resource );
+      for( int i = 0; i < 100; ++i ) {
+         jagged.push_back( vecmem::vector< int >( i % 10, i, &resource ) );
+      }
+      benchmark::DoNotOptimize( jagged.data() );
+   }
+}
+BENCHMARK( host_resource_jagged_vector )->ArgName( "cache" )->Arg( 0 )
+   ->Arg( 1 );
+
+/// Allocate and free blocks of a given size, one at a time
+static void host_resource_allocate( benchmark::State& state ) {
+
+   vecmem::host_memory_resource& resource = get_resource( state.range( 0 ) );
+   const std::size_t size = state.range( 1 );
+   for( auto _ : state ) {
+      void* ptr = resource.allocate( size );
+      benchmark::DoNotOptimize( ptr );
+      resource.deallocate( ptr, size );
+   }
+}
+BENCHMARK( host_resource_allocate )->ArgNames( { "cache", "size" } )
+   ->ArgsProduct( { { 0, 1 }, { 16, 256, 1024, 65536 } } );
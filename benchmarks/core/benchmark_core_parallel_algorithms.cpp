@@ -0,0 +1,60 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/parallel_algorithms.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <numeric>
+
+namespace {
+
+   /// Memory resource used in the benchmarks
+   vecmem::host_memory_resource host_resource;
+
+   /// Create the row sizes of a jagged vector
+   vecmem::vector< std::size_t > make_sizes( std::size_t rows ) {
+
+      vecmem::vector< std::size_t > result( rows, &host_resource );
+      for( std::size_t i = 0; i < rows; ++i ) {
+         result[ i ] = ( i * 13 ) % 17;
+      }
+      return result;
+   }
+
+} // private namespace
+
+/// Calculate the offsets of a jagged vector serially
+static void serial_offsets( benchmark::State& state ) {
+
+   const vecmem::vector< std::size_t > sizes = ::make_sizes( state.range( 0 ) );
+   vecmem::vector< std::size_t > offsets( sizes.size() + 1, &host_resource );
+   for( auto _ : state ) {
+      std::exclusive_scan( sizes.begin(), sizes.end(), offsets.begin(),
+                           std::size_t( 0 ) );
+      benchmark::DoNotOptimize( offsets.data() );
+   }
+}
+BENCHMARK( serial_offsets )->Range( 1 << 12, 1 << 24 );
+
+/// Calculate the offsets of a jagged vector in parallel
+static void parallel_offsets( benchmark::State& state ) {
+
+   const vecmem::vector< std::size_t > sizes = ::make_sizes( state.range( 0 ) );
+   vecmem::vector< std::size_t > offsets( sizes.size() + 1, &host_resource );
+   for( auto _ : state ) {
+      vecmem::parallel::make_offsets( vecmem::get_data( sizes ),
+                                      vecmem::get_data( offsets ) );
+      benchmark::DoNotOptimize( offsets.data() );
+   }
+}
+BENCHMARK( parallel_offsets )->Range( 1 << 12, 1 << 24 );
@@ -0,0 +1,124 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/containers/ring_buffer.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+   /// Memory resource used in the benchmarks
+   vecmem::host_memory_resource host_resource;
+
+   /// Type of the elements passed between the threads
+   typedef vecmem::data::vector_view< float > element_type;
+
+   /// The number of elements passed through the queues by every producer
+   static constexpr std::size_t ELEMENTS = 100000;
+
+   /// Bounded queue protected by a mutex and condition variables
+   class mutex_queue {
+
+   public:
+      /// Constructor with a capacity
+      mutex_queue( std::size_t capacity ) : m_capacity( capacity ) {}
+
+      /// Add an element, waiting for space if necessary
+      void push( const element_type& value ) {
+         std::unique_lock< std::mutex > lock( m_mutex );
+         m_not_full.wait( lock, [ this ]() {
+            return m_queue.size() < m_capacity; } );
+         m_queue.push_back( value );
+         m_not_empty.notify_one();
+      }
+      /// Take an element, waiting for one if necessary
+      element_type pop() {
+         std::unique_lock< std::mutex > lock( m_mutex );
+         m_not_empty.wait( lock, [ this ]() { return ! m_queue.empty(); } );
+         const element_type result = m_queue.front();
+         m_queue.pop_front();
+         m_not_full.notify_one();
+         return result;
+      }
+
+   private:
+      /// The capacity of the queue
+      std::size_t m_capacity;
+      /// The elements in the queue
+      std::deque< element_type > m_queue;
+      /// Mutex protecting the queue
+      std::mutex m_mutex;
+      /// Condition signalling that the queue is not full
+      std::condition_variable m_not_full;
+      /// Condition signalling that the queue is not empty
+      std::condition_variable m_not_empty;
+
+   }; // class mutex_queue
+
+   /// Pass elements through a queue with some producer and consumer threads
+   template< typename QUEUE >
+   void run_queue( QUEUE& queue, std::size_t threads ) {
+
+      std::vector< std::thread > workers;
+      for( std::size_t i = 0; i < threads; ++i ) {
+         workers.emplace_back( [ &queue ]() {
+            for( std::size_t j = 0; j < ELEMENTS; ++j ) {
+               queue.push( element_type( j, nullptr ) );
+            }
+         } );
+         workers.emplace_back( [ &queue ]() {
+            std::size_t sum = 0;
+            for( std::size_t j = 0; j < ELEMENTS; ++j ) {
+               sum += queue.pop().m_size;
+            }
+            benchmark::DoNotOptimize( sum );
+         } );
+      }
+      for( std::thread& worker : workers ) {
+         worker.join();
+      }
+   }
+
+} // private namespace
+
+/// Pass elements through a mutex protected queue
+static void mutex_queue_transfer( benchmark::State& state ) {
+
+   ::mutex_queue queue( 1024 );
+   for( auto _ : state ) {
+      ::run_queue( queue, state.range( 0 ) );
+   }
+   state.SetItemsProcessed( state.iterations() * state.range( 0 ) *
+                            ::ELEMENTS );
+}
+BENCHMARK( mutex_queue_transfer )->Arg( 1 )->Arg( 2 )->Arg( 4 )
+   ->UseRealTime();
+
+/// Pass elements through a lock-free ring buffer
+static void ring_buffer_transfer( benchmark::State& state ) {
+
+   vecmem::ring_buffer< ::element_type > queue( 1024, ::host_resource );
+   for( auto _ : state ) {
+      ::run_queue( queue, state.range( 0 ) );
+   }
+   state.SetItemsProcessed( state.iterations() * state.range( 0 ) *
+                            ::ELEMENTS );
+}
+BENCHMARK( ring_buffer_transfer )->Arg( 1 )->Arg( 2 )->Arg( 4 )
+   ->UseRealTime();
@@ -0,0 +1,83 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/search_table.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+   /// Memory resource used in the benchmarks
+   vecmem::host_memory_resource host_resource;
+
+   /// Create a sorted vector of "surface identifiers"
+   vecmem::vector< std::uint64_t > make_sorted( std::size_t size ) {
+
+      vecmem::vector< std::uint64_t > result( size, &host_resource );
+      for( std::size_t i = 0; i < size; ++i ) {
+         result[ i ] = 3 * i + 1;
+      }
+      return result;
+   }
+
+   /// Create the values to search for, in a random order
+   vecmem::vector< std::uint64_t > make_queries( std::size_t size ) {
+
+      static constexpr std::size_t QUERIES = 1 << 16;
+      vecmem::vector< std::uint64_t > result( QUERIES, &host_resource );
+      std::uint64_t state = 12345;
+      for( std::size_t i = 0; i < QUERIES; ++i ) {
+         state = state * 6364136223846793005ull + 1442695040888963407ull;
+         result[ i ] = ( state >> 11 ) % ( 3 * size );
+      }
+      return result;
+   }
+
+} // private namespace
+
+/// Search in a sorted vector using @c std::lower_bound
+static void std_lower_bound( benchmark::State& state ) {
+
+   const auto sorted = ::make_sorted( state.range( 0 ) );
+   const auto queries = ::make_queries( state.range( 0 ) );
+   for( auto _ : state ) {
+      std::size_t sum = 0;
+      for( std::uint64_t query : queries ) {
+         sum += std::lower_bound( sorted.begin(), sorted.end(), query ) -
+                sorted.begin();
+      }
+      benchmark::DoNotOptimize( sum );
+   }
+   state.SetItemsProcessed( state.iterations() * queries.size() );
+}
+BENCHMARK( std_lower_bound )->Range( 1 << 10, 1 << 24 );
+
+/// Search in a @c vecmem::search_table
+static void search_table_lower_bound( benchmark::State& state ) {
+
+   const auto sorted = ::make_sorted( state.range( 0 ) );
+   const auto queries = ::make_queries( state.range( 0 ) );
+   const vecmem::search_table< std::uint64_t >
+      table( vecmem::get_data( sorted ), host_resource );
+   for( auto _ : state ) {
+      std::size_t sum = 0;
+      for( std::uint64_t query : queries ) {
+         sum += table.lower_bound( query );
+      }
+      benchmark::DoNotOptimize( sum );
+   }
+   state.SetItemsProcessed( state.iterations() * queries.size() );
+}
+BENCHMARK( search_table_lower_bound )->Range( 1 << 10, 1 << 24 );
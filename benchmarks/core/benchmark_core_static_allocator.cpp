@@ -0,0 +1,50 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/static_resource_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/inline_host_memory_resource.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+/// Create and fill small vectors through the polymorphic allocator
+static void small_vectors_polymorphic( benchmark::State& state ) {
+
+   vecmem::inline_host_memory_resource resource;
+   for( auto _ : state ) {
+      for( int cluster = 0; cluster < 100; ++cluster ) {
+         vecmem::vector< float > vec( &resource );
+         vec.reserve( 16 );
+         for( int i = 0; i < ( cluster % 16 ) + 1; ++i ) {
+            vec.push_back( static_cast< float >( i ) );
+         }
+         benchmark::DoNotOptimize( vec.data() );
+      }
+   }
+}
+BENCHMARK( small_vectors_polymorphic );
+
+/// Create and fill small vectors through the static allocator
+static void small_vectors_static( benchmark::State& state ) {
+
+   vecmem::inline_host_memory_resource resource;
+   for( auto _ : state ) {
+      for( int cluster = 0; cluster < 100; ++cluster ) {
+         vecmem::static_resource_vector< float,
+                                         vecmem::inline_host_memory_resource >
+            vec( resource );
+         vec.reserve( 16 );
+         for( int i = 0; i < ( cluster % 16 ) + 1; ++i ) {
+            vec.push_back( static_cast< float >( i ) );
+         }
+         benchmark::DoNotOptimize( vec.data() );
+      }
+   }
+}
+BENCHMARK( small_vectors_static );
@@ -0,0 +1,62 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/static_vector.hpp"
+
+// Google Benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstddef>
+
+namespace {
+
+   /// Type that can not be copied with @c memcpy
+   struct non_trivial {
+      non_trivial( float value = 0.f ) : m_value( value ) {}
+      non_trivial( const non_trivial& parent ) : m_value( parent.m_value ) {}
+      non_trivial& operator=( const non_trivial& rhs ) {
+         m_value = rhs.m_value;
+         return *this;
+      }
+      float m_value;
+   }; // struct non_trivial
+
+   /// Capacity of the vectors used in the benchmarks
+   static constexpr std::size_t vector_capacity = 1024;
+
+} // private namespace
+
+/// Copy a full vector
+template< typename TYPE >
+static void static_vector_copy( benchmark::State& state ) {
+
+   const vecmem::static_vector< TYPE, vector_capacity >
+      source( vector_capacity, TYPE( 1.f ) );
+   for( auto _ : state ) {
+      vecmem::static_vector< TYPE, vector_capacity > copy( source );
+      benchmark::DoNotOptimize( copy.data() );
+   }
+}
+BENCHMARK_TEMPLATE( static_vector_copy, float );
+BENCHMARK_TEMPLATE( static_vector_copy, non_trivial );
+
+/// Insert and erase an element at the front of a half-full vector
+template< typename TYPE >
+static void static_vector_insert_erase( benchmark::State& state ) {
+
+   vecmem::static_vector< TYPE, vector_capacity >
+      vec( vector_capacity / 2, TYPE( 1.f ) );
+   for( auto _ : state ) {
+      vec.insert( vec.begin(), TYPE( 2.f ) );
+      vec.erase( vec.begin() );
+      benchmark::DoNotOptimize( vec.data() );
+   }
+}
+BENCHMARK_TEMPLATE( static_vector_insert_erase, float );
+BENCHMARK_TEMPLATE( static_vector_insert_erase, non_trivial );
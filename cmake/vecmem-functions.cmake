@@ -74,6 +74,29 @@ function( vecmem_add_test name )
 
 endfunction( vecmem_add_test )
 
+# Helper function for setting up the VecMem benchmarks.
+#
+# Usage: vecmem_add_benchmark( core_copy source1.cpp source2.cpp
+#                              LINK_LIBRARIES vecmem::core )
+#
+function( vecmem_add_benchmark name )
+
+   # Parse the function's options.
+   cmake_parse_arguments( ARG "" "" "LINK_LIBRARIES" ${ARGN} )
+
+   # Create the benchmark executable.
+   set( bench_exe_name "vecmem_benchmark_${name}" )
+   add_executable( ${bench_exe_name} ${ARG_UNPARSED_ARGUMENTS} )
+   if( ARG_LINK_LIBRARIES )
+      target_link_libraries( ${bench_exe_name} PRIVATE ${ARG_LINK_LIBRARIES} )
+   endif()
+   foreach( _config "" "_DEBUG" "_RELEASE" "_MINSIZEREL" "_RELWITHDEBINFO" )
+      set_property( TARGET ${bench_exe_name} PROPERTY
+         RUNTIME_OUTPUT_DIRECTORY${_config} "${CMAKE_BINARY_DIR}/benchmark-bin" )
+   endforeach()
+
+endfunction( vecmem_add_benchmark )
+
 # Helper function for adding individual flags to "flag variables".
 #
 # Usage: vecmem_add_flag( CMAKE_CXX_FLAGS "-Wall" )
@@ -0,0 +1,45 @@
+# VecMem project, part of the ACTS project (R&D line)
+#
+# (c) 2021 CERN for the benefit of the ACTS project
+#
+# Mozilla Public License Version 2.0
+
+# Guard against multiple includes.
+include_guard( GLOBAL )
+
+# Look for Google Benchmark.
+find_package( benchmark )
+
+# If it was found, then we're finished.
+if( benchmark_FOUND )
+   return()
+endif()
+
+# CMake include(s).
+cmake_minimum_required( VERSION 3.11 )
+include( FetchContent )
+
+# Tell the user what's happening.
+message( STATUS "Building Google Benchmark as part of the project" )
+
+# Declare where to get Google Benchmark from.
+FetchContent_Declare( GoogleBenchmark
+   URL "https://github.com/google/benchmark/archive/refs/tags/v1.5.3.tar.gz" )
+
+# Options used in the build of Google Benchmark.
+set( BENCHMARK_ENABLE_TESTING OFF CACHE BOOL
+   "Turn off the tests in Google Benchmark" )
+
+# Get it into the current directory.
+FetchContent_Populate( GoogleBenchmark )
+add_subdirectory( "${googlebenchmark_SOURCE_DIR}"
+   "${googlebenchmark_BINARY_DIR}" EXCLUDE_FROM_ALL )
+
+# Set up aliases for the Google Benchmark targets with the same name that they
+# have when we find Google Benchmark pre-installed.
+if( NOT TARGET benchmark::benchmark )
+   add_library( benchmark::benchmark ALIAS benchmark )
+endif()
+if( NOT TARGET benchmark::benchmark_main )
+   add_library( benchmark::benchmark_main ALIAS benchmark_main )
+endif()
@@ -13,11 +13,18 @@ vecmem_check_language( SYCL )
 # Set up the project's options.
 include( CMakeDependentOption )
 
+# Flag specifying whether the CPU "device" backend should be built.
+option( VECMEM_BUILD_CPU_LIBRARY "Build the vecmem::cpu library" ON )
+
 # Flag specifying whether CUDA support should be built.
 cmake_dependent_option( VECMEM_BUILD_CUDA_LIBRARY
    "Build the vecmem::cuda library" ON
    "CMAKE_CUDA_COMPILER" OFF )
 
+# Flag specifying whether the CUDA library should be tested with a mock runtime.
+option( VECMEM_BUILD_CUDA_MOCK_TESTS
+   "Test the vecmem::cuda code with a mock CUDA runtime" ON )
+
 # Flag specifying whether HIP support should be built.
 cmake_dependent_option( VECMEM_BUILD_HIP_LIBRARY
    "Build the vecmem::hip library" ON
@@ -27,3 +34,10 @@ cmake_dependent_option( VECMEM_BUILD_HIP_LIBRARY
 cmake_dependent_option( VECMEM_BUILD_SYCL_LIBRARY
    "Build the vecmem::sycl library" ON
    "CMAKE_SYCL_COMPILER" OFF )
+
+# Flag specifying whether the host memory cache should use initial-exec TLS.
+option( VECMEM_HOST_CACHE_INITIAL_EXEC_TLS
+   "Use initial-exec TLS for the host memory cache (prevents dlopen)" OFF )
+
+# Flag specifying whether the benchmarks should be built.
+option( VECMEM_BUILD_BENCHMARKING "Build the benchmarks of the project" OFF )
@@ -9,6 +9,7 @@
 // Local include(s).
 #include "vecmem/containers/data/vector_view.hpp"
 #include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/no_init.hpp"
 #include "vecmem/utils/reverse_iterator.hpp"
 #include "vecmem/utils/types.hpp"
 
@@ -23,6 +24,68 @@ namespace vecmem {
       /// Invalid size parameter for @c vecmem::array
       static constexpr std::size_t array_invalid_size =
          static_cast< std::size_t >( -1 );
+
+      /// Largest array (in bytes) that @c vecmem::array may store inline
+      static constexpr std::size_t array_max_inline_bytes = 256;
+
+      /// Helper type storing the size of a @c vecmem::array, and possibly its
+      /// elements as well
+      ///
+      /// This default implementation is used for arrays with a compile time
+      /// size that are too large to store their elements inline. It does not
+      /// need to store anything.
+      ///
+      template< typename T, std::size_t N,
+                bool INLINE = ( ( N != array_invalid_size ) && ( N != 0 ) &&
+                                ( N * sizeof( T ) <=
+                                  array_max_inline_bytes ) ) >
+      struct array_storage {
+         /// Flag showing whether the elements may be stored inline
+         static constexpr bool has_inline_storage = false;
+      };
+
+      /// Specialisation for arrays with a runtime size
+      template< typename T >
+      struct array_storage< T, array_invalid_size, false > {
+         /// Flag showing whether the elements may be stored inline
+         static constexpr bool has_inline_storage = false;
+         /// The size of the array
+         std::size_t m_size = 0;
+      };
+
+      /// Specialisation for small arrays with a compile time size
+      template< typename T, std::size_t N >
+      struct array_storage< T, N, true > {
+         /// Flag showing whether the elements may be stored inline
+         static constexpr bool has_inline_storage = true;
+         /// Storage for the elements of the array
+         alignas( T ) char m_inline[ N * sizeof( T ) ];
+      };
+
+      /// Helper type providing the size of the array to its deleter
+      ///
+      /// This default implementation is used for arrays with a compile time
+      /// size, so it does not need to store anything.
+      ///
+      template< std::size_t N >
+      struct array_deleter_size {
+         /// Constructor, ignoring the size received at runtime
+         array_deleter_size( std::size_t ) {}
+         /// Get the number of elements in the array
+         static constexpr std::size_t size() { return N; }
+      };
+
+      /// Specialisation for arrays with a runtime size
+      template<>
+      struct array_deleter_size< array_invalid_size > {
+         /// Constructor, remembering the size received at runtime
+         array_deleter_size( std::size_t size ) : m_size( size ) {}
+         /// Get the number of elements in the array
+         std::size_t size() const { return m_size; }
+         /// The number of elements in the array
+         std::size_t m_size;
+      };
+
    } // namespace details
 
    /// Array with a fixed size, chosen during runtime
@@ -35,10 +98,12 @@ namespace vecmem {
    ///
    /// However, to be able to use it as a drop-in replacement for @c std::array,
    /// it does provide an optional second template argument, which can be used
-   /// to set the fixed size of the array at compile time.
+   /// to set the fixed size of the array at compile time. Such arrays do not
+   /// store their size at runtime, and if they are small enough, they can
+   /// store their elements inline (without using a memory resource) as well.
    ///
    template< typename T, std::size_t N = details::array_invalid_size >
-   class array {
+   class array : private details::array_storage< T, N > {
 
    public:
       /// @name Type definitions, mimicking @c std::array
@@ -84,11 +149,17 @@ namespace vecmem {
       /// @}
 
       /// Struct used for deleting the allocated memory block
-      class deleter {
+      ///
+      /// The deleter only stores the size of the array if it is not known at
+      /// compile time.
+      ///
+      class deleter : private details::array_deleter_size< N > {
 
       public:
          /// Constructor
          deleter( size_type size, memory_resource& resource );
+         /// Constructor for elements that were not allocated from a resource
+         deleter( size_type size );
 
          /// Copy constructor
          deleter( const deleter& ) = default;
@@ -103,13 +174,19 @@ namespace vecmem {
          void operator()( void* ptr );
 
       private:
-         /// The number of elements in the array
-         size_type m_size;
-         /// The memory resource used for deleting the memory block
+         /// The memory resource used for deleting the memory block (if any)
          memory_resource* m_resource;
 
       }; // struct deleter
 
+      /// Default constructor, storing the elements inline
+      ///
+      /// Can only be used for small arrays, whose size was set using the size
+      /// template parameter. The elements of such arrays are stored inside of
+      /// the array object itself, without any memory allocation.
+      ///
+      array();
+
       /// Constructor with a memory resource to use
       ///
       /// Can only be used if the user chose a non-default value for the size
@@ -124,9 +201,36 @@ namespace vecmem {
       ///
       array( memory_resource& resource, size_type size );
 
+      /// Constructor with a memory resource, without initialising the elements
+      ///
+      /// Trivially default constructible elements are left uninitialised,
+      /// all other elements are default-initialised. Can only be used if the
+      /// user chose a non-default value for the size template parameter.
+      ///
+      array( memory_resource& resource, no_init_t );
+
+      /// Constructor with a size and a memory resource, without initialising
+      /// the elements
+      ///
+      /// Trivially default constructible elements are left uninitialised,
+      /// all other elements are default-initialised. Can only be used if the
+      /// user uses the default (invalid) value for the size template
+      /// parameter.
+      ///
+      array( memory_resource& resource, size_type size, no_init_t );
+
+      /// Move constructor
+      ///
+      /// Arrays with allocated storage become empty after being moved from.
+      ///
+      array( array&& parent );
+
       /// Destructor
       ~array() = default;
 
+      /// Move assignment operator
+      array& operator=( array&& rhs );
+
       /// @name Element accessor functions/operators
       /// @{
 
@@ -215,10 +319,16 @@ namespace vecmem {
       /// @}
 
    private:
-      /// The size of the allocated array
-      size_type m_size;
+      /// Type of the smart pointer managing the elements
+      typedef std::unique_ptr< value_type, deleter > memory_type;
+
+      /// Get a pointer to the inline storage of the array
+      pointer inline_data();
+      /// Take over the elements of another array
+      void take_elements( array& parent );
+
       /// The allocated array
-      std::unique_ptr< value_type, deleter > m_memory;
+      memory_type m_memory;
 
    }; // class array
 
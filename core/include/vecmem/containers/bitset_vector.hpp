@@ -0,0 +1,100 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/bitset_view.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+   /// Packed array of bits, with its memory coming from a memory resource
+   ///
+   /// This is the "host type" of a bitset whose size is chosen at runtime.
+   /// Unlike @c std::vector<bool>, it provides direct access to its memory
+   /// through @c vecmem::data::bitset_view, so that it could be accessed
+   /// through @c vecmem::device_bitset in "device code".
+   ///
+   /// The single bit modification functions are atomic, so they can be used
+   /// from multiple host threads at the same time. The memory resource needs
+   /// to provide host accessible memory.
+   ///
+   class bitset_vector {
+
+   public:
+      /// Size type for the bitset
+      typedef data::bitset_view::size_type size_type;
+      /// Type of the words holding the bits
+      typedef data::bitset_view::word_type word_type;
+
+      /// Constructor with a size and a memory resource
+      bitset_vector( size_type size, memory_resource& resource,
+                     bool value = false );
+
+      /// @name Single bit access/modification functions
+      /// @{
+
+      /// Check the value of one bit
+      bool test( size_type pos ) const;
+      /// Check the value of one bit
+      bool operator[]( size_type pos ) const;
+
+      /// Set one bit, atomically
+      void set( size_type pos );
+      /// Clear one bit, atomically
+      void reset( size_type pos );
+      /// Set one bit atomically, returning its previous value
+      bool test_and_set( size_type pos );
+
+      /// @}
+
+      /// @name Functions operating on the entire bitset
+      /// @{
+
+      /// Return the number of bits in the bitset
+      size_type size() const;
+      /// Return the number of set bits
+      size_type count() const;
+      /// Check whether any of the bits are set
+      bool any() const;
+      /// Check whether none of the bits are set
+      bool none() const;
+
+      /// Set all bits to the same value
+      void fill( bool value );
+
+      /// Perform a bitwise "and" with a bitset of the same size
+      bitset_vector& operator&=( const data::bitset_view& rhs );
+      /// Perform a bitwise "or" with a bitset of the same size
+      bitset_vector& operator|=( const data::bitset_view& rhs );
+      /// Perform a bitwise "xor" with a bitset of the same size
+      bitset_vector& operator^=( const data::bitset_view& rhs );
+
+      /// @}
+
+      /// Get a view of the bitset's data
+      data::bitset_view data() const;
+
+   private:
+      /// Clear the unused bits of the last word
+      void clear_tail();
+
+      /// The number of bits in the bitset
+      size_type m_size;
+      /// The words holding the bits
+      data::vector_buffer< word_type > m_words;
+
+   }; // class bitset_vector
+
+   /// Helper function creating a @c vecmem::data::bitset_view object
+   data::bitset_view get_data( bitset_vector& bits );
+
+} // namespace vecmem
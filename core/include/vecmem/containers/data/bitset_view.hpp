@@ -0,0 +1,60 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem { namespace data {
+
+   /// Simple struct holding data about a bitset
+   ///
+   /// This type is meant to "formalise" the communication of data between
+   /// @c vecmem::bitset_vector ("host type") and @c vecmem::device_bitset
+   /// ("device type").
+   ///
+   /// The bits are packed into 32-bit words, bit @c i being stored in bit
+   /// <tt>i % 32</tt> of word <tt>i / 32</tt>. The unused bits of the last
+   /// word are always kept at zero.
+   ///
+   /// This type does not own the data that it points to. It merely provides a
+   /// "view" of that data.
+   ///
+   struct bitset_view {
+
+      /// Size type used in the class
+      typedef std::size_t size_type;
+      /// Type of the words holding the bits
+      typedef unsigned int word_type;
+
+      /// The number of bits stored in one word
+      static constexpr size_type word_bits = 32;
+
+      /// Default constructor
+      bitset_view() = default;
+      /// Constructor from "raw data"
+      VECMEM_HOST_AND_DEVICE
+      bitset_view( size_type size, word_type* words );
+
+      /// Get the number of words needed for a given number of bits
+      VECMEM_HOST_AND_DEVICE
+      static size_type word_count( size_type size );
+
+      /// The number of bits in the bitset
+      size_type m_size;
+      /// Pointer to the words holding the bits
+      word_type* m_words;
+
+   }; // struct bitset_view
+
+} } // namespace vecmem::data
+
+// Include the implementation.
+#include "vecmem/containers/impl/bitset_view.ipp"
@@ -0,0 +1,65 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/hash_map_view.hpp"
+#include "vecmem/memory/deallocator.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace vecmem::data {
+
+   /// Object owning the data of an open-addressing hash map
+   ///
+   /// The keys, the values and the element counter of the map are allocated
+   /// in a single memory block. The capacity of the map is rounded up to the
+   /// next power of 2.
+   ///
+   template< typename KEY, typename VALUE >
+   class hash_map_buffer : public hash_map_view< KEY, VALUE > {
+
+   public:
+      /// The base type used by this class
+      typedef hash_map_view< KEY, VALUE > base_type;
+      /// Size type used in the class
+      typedef typename base_type::size_type size_type;
+
+      /// @name Checks on the type of the map values
+      /// @{
+
+      /// Make sure that the value type does not have a custom destructor
+      static_assert( std::is_trivially_destructible< VALUE >::value,
+                     "vecmem::data::hash_map_buffer can not handle types with "
+                     "custom destructors" );
+
+      /// @}
+
+      /// Constructor with a capacity
+      ///
+      /// The memory resource needs to provide host accessible memory, as the
+      /// slots of the map are marked as empty during construction. (Shared
+      /// memory can be used to access the map from a device as well.)
+      ///
+      VECMEM_HOST
+      hash_map_buffer( size_type capacity, memory_resource& resource );
+
+   private:
+      /// Data object owning the allocated memory
+      std::unique_ptr< char, details::deallocator > m_memory;
+
+   }; // class hash_map_buffer
+
+} // namespace vecmem::data
+
+// Include the implementation.
+#include "vecmem/containers/impl/hash_map_buffer.ipp"
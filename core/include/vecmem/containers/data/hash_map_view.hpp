@@ -0,0 +1,72 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <type_traits>
+
+namespace vecmem { namespace data {
+
+   /// Simple struct holding data about an open-addressing hash map
+   ///
+   /// This type is meant to "formalise" the communication of data between
+   /// @c vecmem::hash_map ("host type") and @c vecmem::device_hash_map
+   /// ("device type").
+   ///
+   /// The map stores its keys and values in two separate arrays, with a
+   /// capacity that is a power of 2. Unused slots are marked by a key with all
+   /// of its bits set (@c empty_key), which can therefore not be stored in
+   /// the map.
+   ///
+   /// This type does not own the data that it points to. It merely provides a
+   /// "view" of that data.
+   ///
+   template< typename KEY, typename VALUE >
+   struct hash_map_view {
+
+      /// Make sure that the key type can be handled with atomic operations
+      static_assert( std::is_integral< KEY >::value &&
+                     ( ( sizeof( KEY ) == 4 ) || ( sizeof( KEY ) == 8 ) ),
+                     "vecmem::data::hash_map_view only supports 4 and 8 byte "
+                     "integral keys" );
+
+      /// Size type used in the class
+      typedef std::size_t size_type;
+      /// Key type of the map
+      typedef KEY key_type;
+      /// Value type of the map
+      typedef VALUE mapped_type;
+
+      /// The key marking unused slots in the map
+      static constexpr key_type empty_key = static_cast< key_type >( -1 );
+
+      /// Default constructor
+      hash_map_view() = default;
+      /// Constructor from "raw data"
+      VECMEM_HOST_AND_DEVICE
+      hash_map_view( size_type capacity, size_type* size, key_type* keys,
+                     mapped_type* values );
+
+      /// The number of slots in the map (a power of 2)
+      size_type m_capacity;
+      /// Pointer to the number of elements in the map
+      size_type* m_size;
+      /// Pointer to the keys of the map
+      key_type* m_keys;
+      /// Pointer to the values of the map
+      mapped_type* m_values;
+
+   }; // struct hash_map_view
+
+} } // namespace vecmem::data
+
+// Include the implementation.
+#include "vecmem/containers/impl/hash_map_view.ipp"
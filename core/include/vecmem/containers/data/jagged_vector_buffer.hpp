@@ -0,0 +1,77 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/containers/details/jagged_vector_layout.hpp"
+#include "vecmem/memory/deallocator.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace vecmem::data {
+
+   /// Object owning the data of a jagged vector
+   ///
+   /// The views describing the inner vectors, and the payload of all the inner
+   /// vectors are held in a single memory block, as described by
+   /// @c vecmem::details::jagged_vector_layout. This allows copying all of the
+   /// data of the jagged vector with a single memory transfer.
+   ///
+   template< typename TYPE >
+   class jagged_vector_buffer : public jagged_vector_view< TYPE > {
+
+   public:
+      /// The base type used by this class
+      typedef jagged_vector_view< TYPE > base_type;
+
+      /// @name Checks on the type of the array element
+      /// @{
+
+      /// Make sure that the template type does not have a custom destructor
+      static_assert( std::is_trivially_destructible< TYPE >::value,
+                     "vecmem::data::jagged_vector_buffer can not handle types "
+                     "with custom destructors" );
+
+      /// @}
+
+      /// Constructor with the number of inner vectors and elements
+      ///
+      /// It is left up to external code to fill the views and the payload in
+      /// the allocated memory.
+      ///
+      VECMEM_HOST
+      jagged_vector_buffer( std::size_t rows, std::size_t elements,
+                            memory_resource& resource );
+
+      /// Get the layout of the owned memory block
+      VECMEM_HOST
+      const details::jagged_vector_layout& layout() const;
+      /// Get a pointer to the start of the owned memory block (non-const)
+      VECMEM_HOST
+      void* memory();
+      /// Get a pointer to the start of the owned memory block (const)
+      VECMEM_HOST
+      const void* memory() const;
+
+   private:
+      /// The layout of the owned memory block
+      details::jagged_vector_layout m_layout;
+      /// Data object owning the allocated memory
+      std::unique_ptr< char, details::deallocator > m_memory;
+
+   }; // class jagged_vector_buffer
+
+} // namespace vecmem::data
+
+// Include the implementation.
+#include "vecmem/containers/impl/jagged_vector_buffer.ipp"
@@ -10,7 +10,9 @@
 
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
 #include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
 #include "vecmem/containers/vector.hpp"
 
 #include <cstddef>
@@ -43,6 +45,23 @@ namespace vecmem::data {
             memory_resource * mem = nullptr
         );
 
+        /**
+         * @brief Construct jagged vector data in existing view storage.
+         *
+         * The views of the inner vectors are written into memory provided by
+         * the caller, which is not owned by the constructed object. This
+         * allows re-using the same view array for many jagged vectors (for
+         * instance, one per event), without any memory allocation.
+         *
+         * @param[in] vec The jagged vector to make a data view for.
+         * @param[in] storage The array to write the views into. It must have
+         * at least as many elements as @c vec.
+         */
+        jagged_vector_data(
+            jagged_vector<T> & vec,
+            const vector_view<vector_view<T>> & storage
+        );
+
         /**
          * @brief Destruct the jagged vector data.
          *
@@ -54,9 +73,20 @@ namespace vecmem::data {
         );
 
     private:
+        /**
+         * Fill the view array from the inner vectors of a jagged vector.
+         *
+         * Use @c vecmem::parallel::make_jagged_vector_view to set up the
+         * views of very large jagged vectors in parallel.
+         */
+        void fill(
+            jagged_vector<T> & vec
+        );
+
         /**
          * The memory manager used to manage the internal state (row data) of
-         * the jagged data.
+         * the jagged data. It is a null pointer if the object does not own
+         * its view array.
          */
         memory_resource * m_mem;
     };
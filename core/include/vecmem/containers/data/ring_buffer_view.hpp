@@ -0,0 +1,61 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem { namespace data {
+
+   /// Simple struct holding data about a bounded ring buffer
+   ///
+   /// This type is meant to "formalise" the communication of data between
+   /// @c vecmem::ring_buffer ("host type") and @c vecmem::device_ring_buffer
+   /// ("accessor type").
+   ///
+   /// Every slot of the buffer has a sequence number next to it, which tells
+   /// the producers and consumers whether the slot is ready to be written or
+   /// read. The capacity of the buffer is a power of 2.
+   ///
+   /// This type does not own the data that it points to. It merely provides a
+   /// "view" of that data.
+   ///
+   template< typename TYPE >
+   struct ring_buffer_view {
+
+      /// Size type used in the class
+      typedef std::size_t size_type;
+      /// Pointer type to the elements
+      typedef TYPE* pointer;
+
+      /// Default constructor
+      ring_buffer_view() = default;
+      /// Constructor from "raw data"
+      VECMEM_HOST_AND_DEVICE
+      ring_buffer_view( size_type capacity, size_type* head, size_type* tail,
+                        size_type* sequences, pointer elements );
+
+      /// The number of slots in the buffer (a power of 2)
+      size_type m_capacity;
+      /// Pointer to the position of the next element to be written
+      size_type* m_head;
+      /// Pointer to the position of the next element to be read
+      size_type* m_tail;
+      /// Pointer to the sequence numbers of the slots
+      size_type* m_sequences;
+      /// Pointer to the slots of the buffer
+      pointer m_elements;
+
+   }; // struct ring_buffer_view
+
+} } // namespace vecmem::data
+
+// Include the implementation.
+#include "vecmem/containers/impl/ring_buffer_view.ipp"
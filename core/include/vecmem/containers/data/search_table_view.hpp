@@ -0,0 +1,60 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem { namespace data {
+
+   /// Simple struct holding data about a static search table
+   ///
+   /// This type is meant to "formalise" the communication of data between
+   /// @c vecmem::search_table ("host type") and
+   /// @c vecmem::device_search_table ("device type").
+   ///
+   /// The elements of the table are stored in the Eytzinger (BFS) layout of
+   /// an implicit binary search tree. Both arrays have @c m_size+1 elements,
+   /// the element with index @c k having its children at indices @c 2k and
+   /// @c 2k+1. The element at index 0 is not part of the tree. For every
+   /// element @c m_indices holds its index in the original, sorted array,
+   /// with @c m_indices[0] set to @c m_size.
+   ///
+   /// This type does not own the data that it points to. It merely provides a
+   /// "view" of that data.
+   ///
+   template< typename TYPE >
+   struct search_table_view {
+
+      /// Size type used in the class
+      typedef std::size_t size_type;
+      /// Pointer type to the elements
+      typedef const TYPE* pointer;
+
+      /// Default constructor
+      search_table_view() = default;
+      /// Constructor from "raw data"
+      VECMEM_HOST_AND_DEVICE
+      search_table_view( size_type size, pointer keys,
+                         const size_type* indices );
+
+      /// Number of elements in the table
+      size_type m_size;
+      /// Pointer to the elements, in Eytzinger order
+      pointer m_keys;
+      /// Pointer to the original indices of the elements, in Eytzinger order
+      const size_type* m_indices;
+
+   }; // struct search_table_view
+
+} } // namespace vecmem::data
+
+// Include the implementation.
+#include "vecmem/containers/impl/search_table_view.ipp"
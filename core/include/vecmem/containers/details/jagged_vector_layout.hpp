@@ -0,0 +1,75 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::details {
+
+   /// Description of the memory layout of a "packed" jagged vector
+   ///
+   /// A packed jagged vector lives in a single memory block. The block starts
+   /// with the array of @c vecmem::data::vector_view objects describing the
+   /// inner vectors, which is followed by the payload of all the inner vectors,
+   /// one after the other.
+   ///
+   struct jagged_vector_layout {
+      /// The number of inner vectors
+      std::size_t m_rows;
+      /// The total number of elements in all of the inner vectors
+      std::size_t m_elements;
+      /// The offset of the payload from the start of the memory block
+      std::size_t m_payload_offset;
+      /// The size of the entire memory block
+      std::size_t m_total_bytes;
+   }; // struct jagged_vector_layout
+
+   /// Calculate the layout of a packed jagged vector
+   template< typename TYPE >
+   jagged_vector_layout make_jagged_vector_layout( std::size_t rows,
+                                                   std::size_t elements );
+
+   /// Calculate the layout needed to pack an existing jagged vector
+   template< typename TYPE >
+   jagged_vector_layout
+   make_jagged_vector_layout( const data::jagged_vector_view< TYPE >& view );
+
+   /// Pack a jagged vector into a (host accessible) memory block
+   ///
+   /// The views written into @c target point into the memory block starting at
+   /// @c base. Which allows packing the data in a host accessible "staging
+   /// area" for a memory block that is not host accessible itself.
+   ///
+   /// @param from The (host accessible) jagged vector to pack
+   /// @param layout The layout calculated for @c from
+   /// @param target The host accessible memory block to pack the data into
+   /// @param base The start of the memory block that the data is meant for
+   ///
+   template< typename TYPE >
+   void pack_jagged_vector( const data::jagged_vector_view< TYPE >& from,
+                            const jagged_vector_layout& layout,
+                            void* target, void* base );
+
+   /// Re-point the views of a packed jagged vector to a new memory block
+   ///
+   /// This is needed after a packed jagged vector was copied as a single
+   /// memory block, into a host accessible memory block.
+   ///
+   template< typename TYPE >
+   void rebase_jagged_vector( data::vector_view< TYPE >* views,
+                              std::size_t rows, const void* old_base,
+                              void* new_base );
+
+} // namespace vecmem::details
+
+// Include the implementation.
+#include "vecmem/containers/impl/jagged_vector_layout.ipp"
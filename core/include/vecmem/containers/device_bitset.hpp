@@ -0,0 +1,91 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/bitset_view.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+   /// Class providing access to a bitset in "device code"
+   ///
+   /// The functions modifying individual bits use atomic operations, so they
+   /// can be called by any number of threads at the same time. The functions
+   /// operating on the entire bitset are not atomic.
+   ///
+   class device_bitset {
+
+   public:
+      /// Size type for the bitset
+      typedef data::bitset_view::size_type size_type;
+      /// Type of the words holding the bits
+      typedef data::bitset_view::word_type word_type;
+
+      /// Constructor, on top of a previously allocated/filled bitset
+      VECMEM_HOST_AND_DEVICE
+      device_bitset( const data::bitset_view& data );
+
+      /// @name Single bit access/modification functions
+      /// @{
+
+      /// Check the value of one bit
+      VECMEM_HOST_AND_DEVICE
+      bool test( size_type pos ) const;
+      /// Check the value of one bit
+      VECMEM_HOST_AND_DEVICE
+      bool operator[]( size_type pos ) const;
+
+      /// Set one bit, atomically
+      VECMEM_HOST_AND_DEVICE
+      void set( size_type pos );
+      /// Clear one bit, atomically
+      VECMEM_HOST_AND_DEVICE
+      void reset( size_type pos );
+      /// Set one bit atomically, returning its previous value
+      ///
+      /// This can be used to "claim" an element, with exactly one of the
+      /// threads trying to set the same bit receiving @c false.
+      ///
+      VECMEM_HOST_AND_DEVICE
+      bool test_and_set( size_type pos );
+
+      /// @}
+
+      /// @name Functions operating on the entire bitset
+      /// @{
+
+      /// Return the number of bits in the bitset
+      VECMEM_HOST_AND_DEVICE
+      size_type size() const;
+      /// Return the number of set bits
+      VECMEM_HOST_AND_DEVICE
+      size_type count() const;
+
+      /// @}
+
+   private:
+      /// The view of the bitset's data
+      data::bitset_view m_data;
+
+   }; // class device_bitset
+
+   namespace details {
+
+      /// Count the set bits in a bitset word
+      VECMEM_HOST_AND_DEVICE
+      int popcount( data::bitset_view::word_type word );
+
+   } // namespace details
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/device_bitset.ipp"
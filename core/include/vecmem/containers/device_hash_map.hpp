@@ -0,0 +1,132 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/hash_map_view.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+   /// Class providing access to an open-addressing hash map in "device code"
+   ///
+   /// Elements can be inserted into, and looked up from the map by any number
+   /// of threads at the same time. Insertions claim the slots of the map with
+   /// atomic compare-and-swap operations, so they never block each other.
+   /// The value of a freshly inserted element however only becomes visible to
+   /// other threads once the insertion phase has finished (for instance once
+   /// a kernel, or a parallel host loop has completed). Elements can not be
+   /// removed from the map.
+   ///
+   /// Collisions are resolved using linear probing. The map can not grow, so
+   /// its capacity should be chosen to be (at least) about twice the number
+   /// of elements that it would need to hold.
+   ///
+   template< typename KEY, typename VALUE >
+   class device_hash_map {
+
+   public:
+      /// @name Type definitions, mimicking @c std::unordered_map
+      /// @{
+
+      /// Key type of the map
+      typedef KEY                key_type;
+      /// Value type of the map
+      typedef VALUE              mapped_type;
+      /// Size type for the map
+      typedef std::size_t        size_type;
+
+      /// Value pointer type
+      typedef mapped_type*       pointer;
+      /// Constant value pointer type
+      typedef const mapped_type* const_pointer;
+
+      /// @}
+
+      /// Constructor, on top of a previously allocated/initialised hash map
+      VECMEM_HOST_AND_DEVICE
+      device_hash_map( const data::hash_map_view< KEY, VALUE >& data );
+
+      /// @name Element insertion and lookup functions
+      /// @{
+
+      /// Insert a new element into the map
+      ///
+      /// @return @c true if the element was inserted, @c false if the key was
+      ///         already in the map, or if the map is full
+      ///
+      VECMEM_HOST_AND_DEVICE
+      bool insert( key_type key, const mapped_type& value );
+
+      /// Find the value belonging to a key (non-const)
+      ///
+      /// @return A pointer to the value, or a null pointer if the key is not
+      ///         in the map
+      ///
+      VECMEM_HOST_AND_DEVICE
+      pointer find( key_type key );
+      /// Find the value belonging to a key (const)
+      ///
+      /// @return A pointer to the value, or a null pointer if the key is not
+      ///         in the map
+      ///
+      VECMEM_HOST_AND_DEVICE
+      const_pointer find( key_type key ) const;
+
+      /// Check whether a key is in the map
+      VECMEM_HOST_AND_DEVICE
+      bool contains( key_type key ) const;
+
+      /// @}
+
+      /// @name Capacity checking functions
+      /// @{
+
+      /// Check whether the map is empty
+      VECMEM_HOST_AND_DEVICE
+      bool empty() const;
+      /// Return the number of elements in the map
+      VECMEM_HOST_AND_DEVICE
+      size_type size() const;
+      /// Return the number of slots in the map
+      VECMEM_HOST_AND_DEVICE
+      size_type capacity() const;
+
+      /// @}
+
+   private:
+      /// Find the slot holding a given key, or return the capacity if the key
+      /// is not in the map
+      VECMEM_HOST_AND_DEVICE
+      size_type find_slot( key_type key ) const;
+
+      /// The view of the map's data
+      data::hash_map_view< KEY, VALUE > m_data;
+
+   }; // class device_hash_map
+
+   namespace details {
+
+      /// Calculate the starting slot of a key in a hash map
+      ///
+      /// The key's bits are mixed using the finaliser of the MurmurHash3
+      /// algorithm, so that consecutive keys would end up in different parts
+      /// of the map.
+      ///
+      template< typename KEY >
+      VECMEM_HOST_AND_DEVICE
+      std::size_t hash_map_slot( KEY key, std::size_t capacity );
+
+   } // namespace details
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/device_hash_map.ipp"
@@ -0,0 +1,80 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/ring_buffer_view.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <type_traits>
+
+namespace vecmem {
+
+   /// Class providing access to a bounded multi-producer/multi-consumer queue
+   ///
+   /// The implementation follows Dmitry Vyukov's bounded MPMC queue. The
+   /// producers and the consumers claim positions in the buffer with atomic
+   /// compare-and-swap operations on the head/tail counters, and then hand
+   /// over the slots to each other through the per-slot sequence numbers.
+   /// No locks are taken, and no memory is allocated during the operations.
+   ///
+   template< typename TYPE >
+   class device_ring_buffer {
+
+   public:
+      /// Make sure that elements can be copied in and out of the buffer
+      static_assert( std::is_trivially_copyable< TYPE >::value,
+                     "vecmem::device_ring_buffer can only hold trivially "
+                     "copyable types" );
+
+      /// Type of the buffer elements
+      typedef TYPE              value_type;
+      /// Size type for the buffer
+      typedef std::size_t       size_type;
+      /// Constant value reference type
+      typedef const value_type& const_reference;
+
+      /// Constructor, on top of a previously allocated/initialised buffer
+      VECMEM_HOST_AND_DEVICE
+      device_ring_buffer( const data::ring_buffer_view< TYPE >& data );
+
+      /// Try to add an element to the buffer
+      ///
+      /// @return @c false if the buffer was full, @c true otherwise
+      ///
+      VECMEM_HOST_AND_DEVICE
+      bool try_push( const_reference value );
+      /// Try to take an element from the buffer
+      ///
+      /// @return @c false if the buffer was empty, @c true otherwise
+      ///
+      VECMEM_HOST_AND_DEVICE
+      bool try_pop( value_type& value );
+
+      /// Return the (approximate) number of elements in the buffer
+      ///
+      /// The result is only exact if no other threads are accessing the
+      /// buffer at the same time.
+      ///
+      VECMEM_HOST_AND_DEVICE
+      size_type size() const;
+      /// Return the number of slots in the buffer
+      VECMEM_HOST_AND_DEVICE
+      size_type capacity() const;
+
+   private:
+      /// The view of the buffer's data
+      data::ring_buffer_view< TYPE > m_data;
+
+   }; // class device_ring_buffer
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/device_ring_buffer.ipp"
@@ -0,0 +1,92 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/search_table_view.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+   /// Class providing lookups in a static search table in "device code"
+   ///
+   /// The searches descend the implicit binary tree described by
+   /// @c vecmem::data::search_table_view without any data dependent branches.
+   /// As the first levels of the tree are stored next to each other, they
+   /// stay in the cache between searches. In host code the elements a few
+   /// levels further down the tree are also prefetched during the descent.
+   ///
+   template< typename TYPE >
+   class device_search_table {
+
+   public:
+      /// @name Type definitions
+      /// @{
+
+      /// Type of the table elements
+      typedef TYPE              value_type;
+      /// Size type for the table
+      typedef std::size_t       size_type;
+      /// Constant value reference type
+      typedef const value_type& const_reference;
+
+      /// @}
+
+      /// Constructor, on top of a previously filled search table
+      VECMEM_HOST_AND_DEVICE
+      device_search_table( const data::search_table_view< TYPE >& data );
+
+      /// @name Lookup functions
+      /// @{
+
+      /// Find the first element that is not less than a value
+      ///
+      /// @return The index of the element in the original, sorted array, or
+      ///         @c size() if all elements are less than the value
+      ///
+      VECMEM_HOST_AND_DEVICE
+      size_type lower_bound( const_reference value ) const;
+
+      /// Find an element equal to a value
+      ///
+      /// @return The index of the element in the original, sorted array, or
+      ///         @c size() if no such element exists
+      ///
+      VECMEM_HOST_AND_DEVICE
+      size_type find( const_reference value ) const;
+
+      /// @}
+
+      /// @name Capacity checking functions
+      /// @{
+
+      /// Check whether the table is empty
+      VECMEM_HOST_AND_DEVICE
+      bool empty() const;
+      /// Return the number of elements in the table
+      VECMEM_HOST_AND_DEVICE
+      size_type size() const;
+
+      /// @}
+
+   private:
+      /// Find the Eytzinger index of the first element not less than a value
+      VECMEM_HOST_AND_DEVICE
+      size_type lower_bound_slot( const_reference value ) const;
+
+      /// The view of the table's data
+      data::search_table_view< TYPE > m_data;
+
+   }; // class device_search_table
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/device_search_table.ipp"
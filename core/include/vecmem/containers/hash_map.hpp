@@ -0,0 +1,152 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/hash_map_buffer.hpp"
+#include "vecmem/containers/data/hash_map_view.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+   /// Open-addressing hash map with a fixed capacity
+   ///
+   /// This is the "host type" of the hash map, which owns the memory of the
+   /// map. Its interface is modelled on @c std::unordered_map, but it can only
+   /// hold integral keys (apart from the key with all bits set), its capacity
+   /// is fixed at construction, and it does not provide iterators. Its data
+   /// can be accessed in "device code" through @c vecmem::device_hash_map.
+   ///
+   /// The insertion and lookup functions can be called from multiple host
+   /// threads at the same time, with the same caveats as described for
+   /// @c vecmem::device_hash_map.
+   ///
+   /// The memory resource needs to provide host accessible memory.
+   ///
+   template< typename KEY, typename VALUE >
+   class hash_map {
+
+   public:
+      /// @name Type definitions, mimicking @c std::unordered_map
+      /// @{
+
+      /// Key type of the map
+      typedef KEY                key_type;
+      /// Value type of the map
+      typedef VALUE              mapped_type;
+      /// Size type for the map
+      typedef std::size_t        size_type;
+
+      /// Value reference type
+      typedef mapped_type&       reference;
+      /// Constant value reference type
+      typedef const mapped_type& const_reference;
+      /// Value pointer type
+      typedef mapped_type*       pointer;
+      /// Constant value pointer type
+      typedef const mapped_type* const_pointer;
+
+      /// @}
+
+      /// Constructor with a capacity and a memory resource
+      ///
+      /// The capacity is rounded up to the next power of 2.
+      ///
+      VECMEM_HOST
+      hash_map( size_type capacity, memory_resource& resource );
+
+      /// @name Element insertion and lookup functions
+      /// @{
+
+      /// Insert a new element into the map
+      ///
+      /// @return @c true if the element was inserted, @c false if the key was
+      ///         already in the map, or if the map is full
+      ///
+      VECMEM_HOST
+      bool insert( key_type key, const mapped_type& value );
+
+      /// Find the value belonging to a key (non-const)
+      ///
+      /// @return A pointer to the value, or a null pointer if the key is not
+      ///         in the map
+      ///
+      VECMEM_HOST
+      pointer find( key_type key );
+      /// Find the value belonging to a key (const)
+      ///
+      /// @return A pointer to the value, or a null pointer if the key is not
+      ///         in the map
+      ///
+      VECMEM_HOST
+      const_pointer find( key_type key ) const;
+
+      /// Return the value belonging to a key in a "safe way" (non-const)
+      VECMEM_HOST
+      reference at( key_type key );
+      /// Return the value belonging to a key in a "safe way" (const)
+      VECMEM_HOST
+      const_reference at( key_type key ) const;
+
+      /// Check whether a key is in the map
+      VECMEM_HOST
+      bool contains( key_type key ) const;
+
+      /// @}
+
+      /// @name Capacity checking/modifying functions
+      /// @{
+
+      /// Check whether the map is empty
+      VECMEM_HOST
+      bool empty() const;
+      /// Return the number of elements in the map
+      VECMEM_HOST
+      size_type size() const;
+      /// Return the number of slots in the map
+      VECMEM_HOST
+      size_type capacity() const;
+
+      /// Remove all elements from the map
+      ///
+      /// Unlike the insertion and lookup functions, this function must not
+      /// be called while other threads are accessing the map.
+      ///
+      VECMEM_HOST
+      void clear();
+
+      /// @}
+
+      /// @name Data access functions
+      /// @{
+
+      /// Get a view of the map's data
+      VECMEM_HOST
+      const data::hash_map_view< KEY, VALUE >& data() const;
+
+      /// @}
+
+   private:
+      /// The buffer holding the map's data
+      data::hash_map_buffer< KEY, VALUE > m_buffer;
+
+   }; // class hash_map
+
+   /// Helper function creating a @c vecmem::data::hash_map_view object
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   data::hash_map_view< KEY, VALUE >
+   get_data( hash_map< KEY, VALUE >& map );
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/hash_map.ipp"
@@ -7,15 +7,44 @@
 #pragma once
 
 // System include(s).
-#include <algorithm>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace vecmem {
 
    namespace details {
 
+      /// Helper function calling a functor with every index of a sequence
+      template< typename FUNCTION, std::size_t... INDICES >
+      void array_unrolled_for( FUNCTION f,
+                               std::index_sequence< INDICES... > ) {
+
+         ( f( INDICES ), ... );
+      }
+
+      /// Helper function calling a functor with every index of an array
+      ///
+      /// The loop is unrolled at compile time for arrays that may store their
+      /// elements inline. Such arrays have either @c N or (after being moved
+      /// from) no elements.
+      ///
+      template< typename T, std::size_t N, typename FUNCTION >
+      void array_for_each_index( std::size_t size, FUNCTION f ) {
+
+         if constexpr( array_storage< T, N >::has_inline_storage ) {
+            if( size != 0 ) {
+               array_unrolled_for( f, std::make_index_sequence< N >() );
+            }
+         } else {
+            for( std::size_t i = 0; i < size; ++i ) {
+               f( i );
+            }
+         }
+      }
+
       /// Helper function used in the @c vecmem::array constructors
       template< typename T, std::size_t N >
       std::unique_ptr< typename vecmem::array< T, N >::value_type,
@@ -40,10 +69,31 @@ namespace vecmem {
                           typename vecmem::array< T, N >::deleter > memory,
          typename vecmem::array< T, N >::size_type size ) {
 
-         typename vecmem::array< T, N >::size_type i = 0;
-         for( typename vecmem::array< T, N >::pointer ptr = memory.get();
-              i < size; ++i, ++ptr ) {
-            new( ptr ) typename vecmem::array< T, N >::value_type();
+         typedef typename vecmem::array< T, N >::value_type value_type;
+         typename vecmem::array< T, N >::pointer ptr = memory.get();
+         array_for_each_index< T, N >( size, [ ptr ]( std::size_t i ) {
+            new( ptr + i ) value_type();
+         } );
+         return memory;
+      }
+
+      /// Helper function used in the @c vecmem::array constructors
+      template< typename T, std::size_t N >
+      std::unique_ptr< typename vecmem::array< T, N >::value_type,
+                       typename vecmem::array< T, N >::deleter >
+      default_initialize_array_memory(
+         std::unique_ptr< typename vecmem::array< T, N >::value_type,
+                          typename vecmem::array< T, N >::deleter > memory,
+         typename vecmem::array< T, N >::size_type size ) {
+
+         // Trivial types don't need to be touched at all.
+         typedef typename vecmem::array< T, N >::value_type value_type;
+         if constexpr( ! std::is_trivially_default_constructible<
+                          value_type >::value ) {
+            typename vecmem::array< T, N >::pointer ptr = memory.get();
+            array_for_each_index< T, N >( size, [ ptr ]( std::size_t i ) {
+               new( ptr + i ) value_type;
+            } );
          }
          return memory;
       }
@@ -53,30 +103,47 @@ namespace vecmem {
    template< typename T, std::size_t N >
    array< T, N >::deleter::deleter( size_type size,
                                     memory_resource& resource )
-   : m_size( size ), m_resource( &resource ) {
+   : details::array_deleter_size< N >( size ), m_resource( &resource ) {
+
+   }
+
+   template< typename T, std::size_t N >
+   array< T, N >::deleter::deleter( size_type size )
+   : details::array_deleter_size< N >( size ), m_resource( nullptr ) {
 
    }
 
    template< typename T, std::size_t N >
    void array< T, N >::deleter::operator()( void* ptr ) {
 
+      const size_type size = this->size();
       // Call the destructor on all objects.
-      size_type i = 0;
-      for( pointer p = reinterpret_cast< pointer >( ptr ); i < m_size;
-           ++i, ++p ) {
-         p->~value_type();
+      if constexpr( ! std::is_trivially_destructible< value_type >::value ) {
+         pointer p = reinterpret_cast< pointer >( ptr );
+         details::array_for_each_index< T, N >( size, [ p ]( size_type i ) {
+            p[ i ].~value_type();
+         } );
       }
-      // De-allocate the array's memory.
-      if( ( m_size != 0 ) && ( ptr != nullptr ) ) {
-         m_resource->deallocate( ptr, m_size * sizeof( value_type ) );
+      // De-allocate the array's memory, if it was allocated from a resource.
+      if( ( size != 0 ) && ( ptr != nullptr ) && ( m_resource != nullptr ) ) {
+         m_resource->deallocate( ptr, size * sizeof( value_type ) );
       }
    }
 
+   template< typename T, std::size_t N >
+   array< T, N >::array()
+   : m_memory( details::initialize_array_memory< T, N >(
+        memory_type( inline_data(), deleter( N ) ), N ) ) {
+
+      static_assert( details::array_storage< T, N >::has_inline_storage,
+                     "Can only use the default constructor for small arrays "
+                     "with a size provided as a template argument" );
+   }
+
    template< typename T, std::size_t N >
    array< T, N >::array( memory_resource& resource )
-   : m_size( N ),
-     m_memory( details::initialize_array_memory< T, N >(
-        details::allocate_array_memory< T, N >( resource, m_size ), m_size ) ) {
+   : m_memory( details::initialize_array_memory< T, N >(
+        details::allocate_array_memory< T, N >( resource, N ), N ) ) {
 
       static_assert( N != details::array_invalid_size,
                      "Can only use the 'compile time constructor' if a size "
@@ -85,22 +152,65 @@ namespace vecmem {
 
    template< typename T, std::size_t N >
    array< T, N >::array( memory_resource& resource, size_type size )
-   : m_size( size ),
+   : details::array_storage< T, N >{ size },
      m_memory( details::initialize_array_memory< T, N >(
-        details::allocate_array_memory< T, N >( resource, m_size ), m_size ) ) {
+        details::allocate_array_memory< T, N >( resource, size ), size ) ) {
 
       static_assert( N == details::array_invalid_size,
                      "Can only use the 'runtime constructor' if a size was not "
                      "provided as a template argument" );
    }
 
+   template< typename T, std::size_t N >
+   array< T, N >::array( memory_resource& resource, no_init_t )
+   : m_memory( details::default_initialize_array_memory< T, N >(
+        details::allocate_array_memory< T, N >( resource, N ), N ) ) {
+
+      static_assert( N != details::array_invalid_size,
+                     "Can only use the 'compile time constructor' if a size "
+                     "was provided as a template argument" );
+   }
+
+   template< typename T, std::size_t N >
+   array< T, N >::array( memory_resource& resource, size_type size, no_init_t )
+   : details::array_storage< T, N >{ size },
+     m_memory( details::default_initialize_array_memory< T, N >(
+        details::allocate_array_memory< T, N >( resource, size ), size ) ) {
+
+      static_assert( N == details::array_invalid_size,
+                     "Can only use the 'runtime constructor' if a size was not "
+                     "provided as a template argument" );
+   }
+
+   template< typename T, std::size_t N >
+   array< T, N >::array( array&& parent )
+   : m_memory( nullptr, deleter( 0 ) ) {
+
+      take_elements( parent );
+   }
+
+   template< typename T, std::size_t N >
+   array< T, N >& array< T, N >::operator=( array&& rhs ) {
+
+      // Avoid self-assignment.
+      if( this == &rhs ) {
+         return *this;
+      }
+
+      // Destroy the current elements, and take over the ones of the other
+      // array.
+      m_memory.reset();
+      take_elements( rhs );
+      return *this;
+   }
+
    template< typename T, std::size_t N >
    typename array< T, N >::reference
    array< T, N >::at( size_type pos ) {
 
-      if( pos >= m_size ) {
+      if( pos >= size() ) {
          throw std::out_of_range( "Requested element " + std::to_string( pos ) +
-                                  " from a " + std::to_string( m_size ) +
+                                  " from a " + std::to_string( size() ) +
                                   " sized vecmem::array" );
       }
       return m_memory.get()[ pos ];
@@ -110,9 +220,9 @@ namespace vecmem {
    typename array< T, N >::const_reference
    array< T, N >::at( size_type pos ) const {
 
-      if( pos >= m_size ) {
+      if( pos >= size() ) {
          throw std::out_of_range( "Requested element " + std::to_string( pos ) +
-                                  " from a " + std::to_string( m_size ) +
+                                  " from a " + std::to_string( size() ) +
                                   " sized vecmem::array" );
       }
       return m_memory.get()[ pos ];
@@ -136,7 +246,7 @@ namespace vecmem {
    typename array< T, N >::reference
    array< T, N >::front() {
 
-      if( m_size == 0 ) {
+      if( empty() ) {
          throw std::out_of_range( "Called vecmem::array::front() on an empty "
                                   "array" );
       }
@@ -147,7 +257,7 @@ namespace vecmem {
    typename array< T, N >::const_reference
    array< T, N >::front() const {
 
-      if( m_size == 0 ) {
+      if( empty() ) {
          throw std::out_of_range( "Called vecmem::array::front() on an empty "
                                   "array" );
       }
@@ -158,22 +268,22 @@ namespace vecmem {
    typename array< T, N >::reference
    array< T, N >::back() {
 
-      if( m_size == 0 ) {
+      if( empty() ) {
          throw std::out_of_range( "Called vecmem::array::back() on an empty "
                                   "array" );
       }
-      return m_memory.get()[ m_size - 1 ];
+      return m_memory.get()[ size() - 1 ];
    }
 
    template< typename T, std::size_t N >
    typename array< T, N >::const_reference
    array< T, N >::back() const {
 
-      if( m_size == 0 ) {
+      if( empty() ) {
          throw std::out_of_range( "Called vecmem::array::back() on an empty "
                                   "array" );
       }
-      return m_memory.get()[ m_size - 1 ];
+      return m_memory.get()[ size() - 1 ];
    }
 
    template< typename T, std::size_t N >
@@ -215,21 +325,21 @@ namespace vecmem {
    typename array< T, N >::iterator
    array< T, N >::end() {
 
-      return ( m_memory.get() + m_size );
+      return ( m_memory.get() + size() );
    }
 
    template< typename T, std::size_t N >
    typename array< T, N >::const_iterator
    array< T, N >::end() const {
 
-      return ( m_memory.get() + m_size );
+      return ( m_memory.get() + size() );
    }
 
    template< typename T, std::size_t N >
    typename array< T, N >::const_iterator
    array< T, N >::cend() const {
 
-      return ( m_memory.get() + m_size );
+      return ( m_memory.get() + size() );
    }
 
    template< typename T, std::size_t N >
@@ -277,20 +387,64 @@ namespace vecmem {
    template< typename T, std::size_t N >
    bool array< T, N >::empty() const noexcept {
 
-      return ( m_size == 0 );
+      return ( size() == 0 );
    }
 
    template< typename T, std::size_t N >
    typename array< T, N >::size_type
    array< T, N >::size() const noexcept {
 
-      return m_size;
+      if constexpr( N == details::array_invalid_size ) {
+         return this->m_size;
+      } else {
+         // Arrays that gave away their allocated storage are empty.
+         return ( m_memory ? N : 0 );
+      }
    }
 
    template< typename T, std::size_t N >
    void array< T, N >::fill( const_reference value ) {
 
-      std::fill( begin(), end(), value );
+      pointer ptr = m_memory.get();
+      details::array_for_each_index< T, N >( size(),
+                                             [ ptr, &value ]( size_type i ) {
+         ptr[ i ] = value;
+      } );
+   }
+
+   template< typename T, std::size_t N >
+   typename array< T, N >::pointer array< T, N >::inline_data() {
+
+      if constexpr( details::array_storage< T, N >::has_inline_storage ) {
+         return reinterpret_cast< pointer >( this->m_inline );
+      } else {
+         return nullptr;
+      }
+   }
+
+   template< typename T, std::size_t N >
+   void array< T, N >::take_elements( array& parent ) {
+
+      // Elements stored inline need to be moved one by one.
+      if constexpr( details::array_storage< T, N >::has_inline_storage ) {
+         if( parent.m_memory.get() == parent.inline_data() ) {
+            pointer from = parent.inline_data();
+            pointer to = inline_data();
+            details::array_for_each_index< T, N >( N,
+                                                   [ from, to ]( size_type i ) {
+               new( to + i ) value_type( std::move( from[ i ] ) );
+            } );
+            m_memory = memory_type( to, deleter( N ) );
+            return;
+         }
+      }
+
+      // Otherwise just take ownership of the parent's memory.
+      m_memory = std::move( parent.m_memory );
+      if constexpr( N == details::array_invalid_size ) {
+         this->m_size = parent.m_size;
+         parent.m_size = 0;
+      }
    }
 
    template< typename T, std::size_t N >
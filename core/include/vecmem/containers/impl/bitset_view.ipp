@@ -0,0 +1,23 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem { namespace data {
+
+   VECMEM_HOST_AND_DEVICE
+   inline bitset_view::bitset_view( size_type size, word_type* words )
+   : m_size( size ), m_words( words ) {
+
+   }
+
+   VECMEM_HOST_AND_DEVICE
+   inline bitset_view::size_type bitset_view::word_count( size_type size ) {
+
+      return ( size + word_bits - 1 ) / word_bits;
+   }
+
+} } // namespace vecmem::data
@@ -0,0 +1,95 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/atomic.hpp"
+
+// System include(s).
+#include <cassert>
+
+namespace vecmem {
+
+   namespace details {
+
+      VECMEM_HOST_AND_DEVICE
+      inline int popcount( data::bitset_view::word_type word ) {
+
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+         return __popc( word );
+#else
+         return __builtin_popcount( word );
+#endif
+      }
+
+   } // namespace details
+
+   VECMEM_HOST_AND_DEVICE
+   inline device_bitset::device_bitset( const data::bitset_view& data )
+   : m_data( data ) {
+
+   }
+
+   VECMEM_HOST_AND_DEVICE
+   inline bool device_bitset::test( size_type pos ) const {
+
+      assert( pos < m_data.m_size );
+      return ( ( m_data.m_words[ pos / data::bitset_view::word_bits ] >>
+                 ( pos % data::bitset_view::word_bits ) ) & 1u );
+   }
+
+   VECMEM_HOST_AND_DEVICE
+   inline bool device_bitset::operator[]( size_type pos ) const {
+
+      return test( pos );
+   }
+
+   VECMEM_HOST_AND_DEVICE
+   inline void device_bitset::set( size_type pos ) {
+
+      test_and_set( pos );
+   }
+
+   VECMEM_HOST_AND_DEVICE
+   inline void device_bitset::reset( size_type pos ) {
+
+      assert( pos < m_data.m_size );
+      const word_type mask = 1u << ( pos % data::bitset_view::word_bits );
+      details::atomic_and( m_data.m_words + pos / data::bitset_view::word_bits,
+                           static_cast< word_type >( ~mask ) );
+   }
+
+   VECMEM_HOST_AND_DEVICE
+   inline bool device_bitset::test_and_set( size_type pos ) {
+
+      assert( pos < m_data.m_size );
+      const word_type mask = 1u << ( pos % data::bitset_view::word_bits );
+      const word_type old =
+         details::atomic_or( m_data.m_words +
+                             pos / data::bitset_view::word_bits, mask );
+      return ( ( old & mask ) != 0 );
+   }
+
+   VECMEM_HOST_AND_DEVICE
+   inline device_bitset::size_type device_bitset::size() const {
+
+      return m_data.m_size;
+   }
+
+   VECMEM_HOST_AND_DEVICE
+   inline device_bitset::size_type device_bitset::count() const {
+
+      // The unused bits of the last word are always zero.
+      size_type result = 0;
+      const size_type words = data::bitset_view::word_count( m_data.m_size );
+      for( size_type i = 0; i < words; ++i ) {
+         result += details::popcount( m_data.m_words[ i ] );
+      }
+      return result;
+   }
+
+} // namespace vecmem
@@ -0,0 +1,156 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/atomic.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstdint>
+
+namespace vecmem {
+
+   namespace details {
+
+      template< typename KEY >
+      VECMEM_HOST_AND_DEVICE
+      std::size_t hash_map_slot( KEY key, std::size_t capacity ) {
+
+         std::uint64_t h = static_cast< std::uint64_t >( key );
+         h ^= h >> 33;
+         h *= 0xff51afd7ed558ccdull;
+         h ^= h >> 33;
+         h *= 0xc4ceb9fe1a85ec53ull;
+         h ^= h >> 33;
+         return static_cast< std::size_t >( h ) & ( capacity - 1 );
+      }
+
+   } // namespace details
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   device_hash_map< KEY, VALUE >::
+   device_hash_map( const data::hash_map_view< KEY, VALUE >& data )
+   : m_data( data ) {
+
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   bool device_hash_map< KEY, VALUE >::insert( key_type key,
+                                               const mapped_type& value ) {
+
+      // The "empty key" can not be stored in the map.
+      assert( key != m_data.empty_key );
+
+      // Probe the slots, starting from the one belonging to the key.
+      const size_type mask = m_data.m_capacity - 1;
+      size_type index = details::hash_map_slot( key, m_data.m_capacity );
+      for( size_type i = 0; i < m_data.m_capacity; ++i ) {
+
+         // Try to claim the slot if it's empty.
+         key_type current = details::atomic_load( m_data.m_keys + index );
+         if( current == m_data.empty_key ) {
+            current = details::atomic_compare_exchange( m_data.m_keys + index,
+                                                        m_data.empty_key,
+                                                        key );
+            if( current == m_data.empty_key ) {
+               m_data.m_values[ index ] = value;
+               details::atomic_add( m_data.m_size, size_type( 1 ) );
+               return true;
+            }
+         }
+         // Stop if the key is already in the map.
+         if( current == key ) {
+            return false;
+         }
+         // Otherwise try the next slot.
+         index = ( index + 1 ) & mask;
+      }
+
+      // The map is full.
+      return false;
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_hash_map< KEY, VALUE >::pointer
+   device_hash_map< KEY, VALUE >::find( key_type key ) {
+
+      const size_type index = find_slot( key );
+      return ( ( index == m_data.m_capacity ) ? nullptr :
+               m_data.m_values + index );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_hash_map< KEY, VALUE >::const_pointer
+   device_hash_map< KEY, VALUE >::find( key_type key ) const {
+
+      const size_type index = find_slot( key );
+      return ( ( index == m_data.m_capacity ) ? nullptr :
+               m_data.m_values + index );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   bool device_hash_map< KEY, VALUE >::contains( key_type key ) const {
+
+      return ( find_slot( key ) != m_data.m_capacity );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   bool device_hash_map< KEY, VALUE >::empty() const {
+
+      return ( size() == 0 );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_hash_map< KEY, VALUE >::size_type
+   device_hash_map< KEY, VALUE >::size() const {
+
+      return details::atomic_load( m_data.m_size );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_hash_map< KEY, VALUE >::size_type
+   device_hash_map< KEY, VALUE >::capacity() const {
+
+      return m_data.m_capacity;
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_hash_map< KEY, VALUE >::size_type
+   device_hash_map< KEY, VALUE >::find_slot( key_type key ) const {
+
+      // The "empty key" is never in the map.
+      if( key == m_data.empty_key ) {
+         return m_data.m_capacity;
+      }
+
+      // Probe the slots until either the key, or an empty slot is found.
+      const size_type mask = m_data.m_capacity - 1;
+      size_type index = details::hash_map_slot( key, m_data.m_capacity );
+      for( size_type i = 0; i < m_data.m_capacity; ++i ) {
+         const key_type current = details::atomic_load( m_data.m_keys + index );
+         if( current == key ) {
+            return index;
+         }
+         if( current == m_data.empty_key ) {
+            break;
+         }
+         index = ( index + 1 ) & mask;
+      }
+      return m_data.m_capacity;
+   }
+
+} // namespace vecmem
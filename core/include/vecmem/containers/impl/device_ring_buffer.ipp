@@ -0,0 +1,118 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/atomic.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   device_ring_buffer< TYPE >::
+   device_ring_buffer( const data::ring_buffer_view< TYPE >& data )
+   : m_data( data ) {
+
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   bool device_ring_buffer< TYPE >::try_push( const_reference value ) {
+
+      // Claim a position for the new element.
+      const size_type mask = m_data.m_capacity - 1;
+      size_type pos = details::atomic_load( m_data.m_head );
+      size_type slot = 0;
+      while( true ) {
+         slot = pos & mask;
+         const size_type sequence =
+            details::atomic_load( m_data.m_sequences + slot );
+         const std::ptrdiff_t diff = static_cast< std::ptrdiff_t >( sequence ) -
+                                     static_cast< std::ptrdiff_t >( pos );
+         if( diff == 0 ) {
+            // The slot is free, try to claim it.
+            const size_type current =
+               details::atomic_compare_exchange( m_data.m_head, pos, pos + 1 );
+            if( current == pos ) {
+               break;
+            }
+            pos = current;
+         } else if( diff < 0 ) {
+            // The slot still holds an element from the previous round.
+            return false;
+         } else {
+            // Another producer claimed this position already.
+            pos = details::atomic_load( m_data.m_head );
+         }
+      }
+
+      // Write the element, and hand the slot over to the consumers.
+      m_data.m_elements[ slot ] = value;
+      details::atomic_store( m_data.m_sequences + slot, pos + 1 );
+      return true;
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   bool device_ring_buffer< TYPE >::try_pop( value_type& value ) {
+
+      // Claim the position of the oldest element.
+      const size_type mask = m_data.m_capacity - 1;
+      size_type pos = details::atomic_load( m_data.m_tail );
+      size_type slot = 0;
+      while( true ) {
+         slot = pos & mask;
+         const size_type sequence =
+            details::atomic_load( m_data.m_sequences + slot );
+         const std::ptrdiff_t diff = static_cast< std::ptrdiff_t >( sequence ) -
+                                     static_cast< std::ptrdiff_t >( pos + 1 );
+         if( diff == 0 ) {
+            // The slot holds an element, try to claim it.
+            const size_type current =
+               details::atomic_compare_exchange( m_data.m_tail, pos, pos + 1 );
+            if( current == pos ) {
+               break;
+            }
+            pos = current;
+         } else if( diff < 0 ) {
+            // The slot has not been written yet.
+            return false;
+         } else {
+            // Another consumer claimed this position already.
+            pos = details::atomic_load( m_data.m_tail );
+         }
+      }
+
+      // Read the element, and hand the slot back to the producers.
+      value = m_data.m_elements[ slot ];
+      details::atomic_store( m_data.m_sequences + slot,
+                             pos + m_data.m_capacity );
+      return true;
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_ring_buffer< TYPE >::size_type
+   device_ring_buffer< TYPE >::size() const {
+
+      const size_type head = details::atomic_load( m_data.m_head );
+      const size_type tail = details::atomic_load( m_data.m_tail );
+      return ( ( head > tail ) ? ( head - tail ) : 0 );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_ring_buffer< TYPE >::size_type
+   device_ring_buffer< TYPE >::capacity() const {
+
+      return m_data.m_capacity;
+   }
+
+} // namespace vecmem
@@ -0,0 +1,85 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem {
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   device_search_table< TYPE >::
+   device_search_table( const data::search_table_view< TYPE >& data )
+   : m_data( data ) {
+
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_search_table< TYPE >::size_type
+   device_search_table< TYPE >::lower_bound( const_reference value ) const {
+
+      return m_data.m_indices[ lower_bound_slot( value ) ];
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_search_table< TYPE >::size_type
+   device_search_table< TYPE >::find( const_reference value ) const {
+
+      const size_type slot = lower_bound_slot( value );
+      const bool found = ( ( slot != 0 ) &&
+                           ( ! ( value < m_data.m_keys[ slot ] ) ) );
+      return ( found ? m_data.m_indices[ slot ] : m_data.m_size );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   bool device_search_table< TYPE >::empty() const {
+
+      return ( m_data.m_size == 0 );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_search_table< TYPE >::size_type
+   device_search_table< TYPE >::size() const {
+
+      return m_data.m_size;
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   typename device_search_table< TYPE >::size_type
+   device_search_table< TYPE >::
+   lower_bound_slot( const_reference value ) const {
+
+      // Descend the tree, going right whenever the current element is less
+      // than the searched value.
+      size_type k = 1;
+      while( k <= m_data.m_size ) {
+#if ! ( defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__) || \
+        defined(__SYCL_DEVICE_ONLY__) )
+         // Prefetch the elements 4 levels further down. These are the 16
+         // descendants of the current element, which are stored next to
+         // each other.
+         const size_type prefetch = 16 * k;
+         __builtin_prefetch( m_data.m_keys +
+                             ( ( prefetch <= m_data.m_size ) ? prefetch : 0 ) );
+#endif
+         k = 2 * k + static_cast< size_type >( m_data.m_keys[ k ] < value );
+      }
+
+      // The lower bound is the last element where the search went left. So
+      // remove the trailing right turns, and the last left turn from the
+      // path. (Leading to index 0 if the search never went left.)
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+      return ( k >> __ffsll( ~static_cast< long long >( k ) ) );
+#else
+      return ( k >> __builtin_ffsll( ~static_cast< long long >( k ) ) );
+#endif
+   }
+
+} // namespace vecmem
@@ -0,0 +1,133 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/device_hash_map.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace vecmem {
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   hash_map< KEY, VALUE >::hash_map( size_type capacity,
+                                     memory_resource& resource )
+   : m_buffer( capacity, resource ) {
+
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   bool hash_map< KEY, VALUE >::insert( key_type key,
+                                        const mapped_type& value ) {
+
+      return device_hash_map< KEY, VALUE >( m_buffer ).insert( key, value );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   typename hash_map< KEY, VALUE >::pointer
+   hash_map< KEY, VALUE >::find( key_type key ) {
+
+      return device_hash_map< KEY, VALUE >( m_buffer ).find( key );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   typename hash_map< KEY, VALUE >::const_pointer
+   hash_map< KEY, VALUE >::find( key_type key ) const {
+
+      const device_hash_map< KEY, VALUE > map( m_buffer );
+      return map.find( key );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   typename hash_map< KEY, VALUE >::reference
+   hash_map< KEY, VALUE >::at( key_type key ) {
+
+      pointer result = find( key );
+      if( result == nullptr ) {
+         throw std::out_of_range( "Key " + std::to_string( key ) +
+                                  " not found in vecmem::hash_map" );
+      }
+      return *result;
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   typename hash_map< KEY, VALUE >::const_reference
+   hash_map< KEY, VALUE >::at( key_type key ) const {
+
+      const_pointer result = find( key );
+      if( result == nullptr ) {
+         throw std::out_of_range( "Key " + std::to_string( key ) +
+                                  " not found in vecmem::hash_map" );
+      }
+      return *result;
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   bool hash_map< KEY, VALUE >::contains( key_type key ) const {
+
+      return ( find( key ) != nullptr );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   bool hash_map< KEY, VALUE >::empty() const {
+
+      return ( size() == 0 );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   typename hash_map< KEY, VALUE >::size_type
+   hash_map< KEY, VALUE >::size() const {
+
+      return device_hash_map< KEY, VALUE >( m_buffer ).size();
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   typename hash_map< KEY, VALUE >::size_type
+   hash_map< KEY, VALUE >::capacity() const {
+
+      return m_buffer.m_capacity;
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   void hash_map< KEY, VALUE >::clear() {
+
+      *( m_buffer.m_size ) = 0;
+      std::fill( m_buffer.m_keys, m_buffer.m_keys + m_buffer.m_capacity,
+                 m_buffer.empty_key );
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   const data::hash_map_view< KEY, VALUE >&
+   hash_map< KEY, VALUE >::data() const {
+
+      return m_buffer;
+   }
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   data::hash_map_view< KEY, VALUE >
+   get_data( hash_map< KEY, VALUE >& map ) {
+
+      return map.data();
+   }
+
+} // namespace vecmem
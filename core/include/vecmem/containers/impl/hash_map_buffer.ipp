@@ -0,0 +1,72 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+
+namespace {
+
+   /// Round a requested capacity up to the next power of 2
+   inline std::size_t hash_map_capacity( std::size_t requested ) {
+
+      std::size_t result = 1;
+      while( result < requested ) {
+         result <<= 1;
+      }
+      return result;
+   }
+
+   /// Round a memory offset up to the specified alignment
+   inline std::size_t hash_map_align( std::size_t offset,
+                                      std::size_t alignment ) {
+
+      return ( ( offset + alignment - 1 ) / alignment ) * alignment;
+   }
+
+} // private namespace
+
+namespace vecmem::data {
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST
+   hash_map_buffer< KEY, VALUE >::
+   hash_map_buffer( size_type capacity, memory_resource& resource )
+   : base_type( ::hash_map_capacity( capacity ), nullptr, nullptr, nullptr ),
+     m_memory( nullptr, { 0, resource } ) {
+
+      static_assert( alignof( VALUE ) <= alignof( std::max_align_t ),
+                     "Over-aligned value types are not supported" );
+
+      // Lay out the counter, the keys and the values in a single memory
+      // block.
+      const std::size_t keys_offset =
+         ::hash_map_align( sizeof( size_type ), alignof( KEY ) );
+      const std::size_t values_offset =
+         ::hash_map_align( keys_offset + base_type::m_capacity * sizeof( KEY ),
+                           alignof( VALUE ) );
+      const std::size_t bytes =
+         values_offset + base_type::m_capacity * sizeof( VALUE );
+
+      // Allocate the memory block.
+      m_memory = std::unique_ptr< char, details::deallocator >(
+         static_cast< char* >( resource.allocate( bytes ) ),
+         { bytes, resource } );
+      base_type::m_size = reinterpret_cast< size_type* >( m_memory.get() );
+      base_type::m_keys =
+         reinterpret_cast< KEY* >( m_memory.get() + keys_offset );
+      base_type::m_values =
+         reinterpret_cast< VALUE* >( m_memory.get() + values_offset );
+
+      // Mark all slots as empty.
+      *( base_type::m_size ) = 0;
+      std::fill( base_type::m_keys, base_type::m_keys + base_type::m_capacity,
+                 base_type::empty_key );
+   }
+
+} // namespace vecmem::data
@@ -0,0 +1,21 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem { namespace data {
+
+   template< typename KEY, typename VALUE >
+   VECMEM_HOST_AND_DEVICE
+   hash_map_view< KEY, VALUE >::
+   hash_map_view( size_type capacity, size_type* size, key_type* keys,
+                  mapped_type* values )
+   : m_capacity( capacity ), m_size( size ), m_keys( keys ),
+     m_values( values ) {
+
+   }
+
+} } // namespace vecmem::data
@@ -0,0 +1,50 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem::data {
+
+   template< typename TYPE >
+   VECMEM_HOST
+   jagged_vector_buffer< TYPE >::
+   jagged_vector_buffer( std::size_t rows, std::size_t elements,
+                         memory_resource& resource )
+   : base_type( rows, nullptr ),
+     m_layout( details::make_jagged_vector_layout< TYPE >( rows, elements ) ),
+     m_memory( m_layout.m_total_bytes == 0 ? nullptr :
+               static_cast< char* >(
+                  resource.allocate( m_layout.m_total_bytes ) ),
+               { m_layout.m_total_bytes, resource } ) {
+
+      // The views are at the start of the memory block.
+      base_type::m_ptr =
+         reinterpret_cast< vector_view< TYPE >* >( m_memory.get() );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   const details::jagged_vector_layout&
+   jagged_vector_buffer< TYPE >::layout() const {
+
+      return m_layout;
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   void* jagged_vector_buffer< TYPE >::memory() {
+
+      return m_memory.get();
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   const void* jagged_vector_buffer< TYPE >::memory() const {
+
+      return m_memory.get();
+   }
+
+} // namespace vecmem::data
@@ -13,6 +13,7 @@
 #include "vecmem/containers/device_vector.hpp"
 #include "vecmem/containers/vector.hpp"
 
+#include <cassert>
 #include <cstddef>
 
 namespace vecmem::data {
@@ -31,33 +32,52 @@ namespace vecmem::data {
         ),
         m_mem(mem == nullptr ? vec.get_allocator().resource() : mem)
     {
+        fill(vec);
+    }
+
+    template<typename T>
+    jagged_vector_data<T>::jagged_vector_data(
+        jagged_vector<T> & vec,
+        const vector_view<vector_view<T>> & storage
+    ) :
+        base_type(vec.size(), storage.m_ptr),
+        m_mem(nullptr)
+    {
+        assert(vec.size() <= storage.m_size);
+        fill(vec);
+    }
+
+    template<typename T>
+    jagged_vector_data<T>::~jagged_vector_data(
+        void
+    ) {
         /*
-         * To construct a jagged view, we copy the important information (the
-         * size and starting pointer) of the standard vectors to our reduced
-         * complexity format.
+         * Use the memory manager to deallocate the memory owned by this
+         * object. Views written into external storage are left alone.
          */
-        for (std::size_t i = 0; i < base_type::m_size; ++i) {
-            /*
-             * We use the memory allocated earlier and construct device vector
-             * objects there.
-             */
-            new (base_type::m_ptr + i) vector_view<T>(
-                vec.at(i).size(),
-                vec.at(i).data()
+        if (m_mem != nullptr) {
+            m_mem->deallocate(
+                base_type::m_ptr,
+                base_type::m_size * sizeof(vector_view<T>)
             );
         }
     }
 
     template<typename T>
-    jagged_vector_data<T>::~jagged_vector_data(
-        void
+    void jagged_vector_data<T>::fill(
+        jagged_vector<T> & vec
     ) {
         /*
-         * Use the memory manager to deallocate the memory owned by this object.
+         * To construct a jagged view, we copy the important information (the
+         * size and starting pointer) of the standard vectors to our reduced
+         * complexity format. The views are constructed in the memory set up
+         * by the constructor, reading the inner vectors directly, without
+         * bounds checks.
          */
-        m_mem->deallocate(
-            base_type::m_ptr,
-            base_type::m_size * sizeof(vector_view<T>)
-        );
+        vecmem::vector<T> * rows = vec.data();
+        vector_view<T> * views = base_type::m_ptr;
+        for (std::size_t i = 0; i < base_type::m_size; ++i) {
+            new (views + i) vector_view<T>(rows[i].size(), rows[i].data());
+        }
     }
 } // namespace vecmem::data
@@ -0,0 +1,88 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstring>
+#include <type_traits>
+
+namespace vecmem::details {
+
+   template< typename TYPE >
+   jagged_vector_layout make_jagged_vector_layout( std::size_t rows,
+                                                   std::size_t elements ) {
+
+      // The type of the views stored in the memory block.
+      typedef data::vector_view< std::remove_cv_t< TYPE > > view_type;
+
+      // The payload starts after the views, at an offset that is suitably
+      // aligned for the payload's type.
+      static constexpr std::size_t alignment = alignof( TYPE );
+      const std::size_t views_bytes = rows * sizeof( view_type );
+      const std::size_t payload_offset =
+         ( ( views_bytes + alignment - 1 ) / alignment ) * alignment;
+
+      return { rows, elements, payload_offset,
+               payload_offset + elements * sizeof( TYPE ) };
+   }
+
+   template< typename TYPE >
+   jagged_vector_layout
+   make_jagged_vector_layout( const data::jagged_vector_view< TYPE >& view ) {
+
+      std::size_t elements = 0;
+      for( std::size_t i = 0; i < view.m_size; ++i ) {
+         elements += view.m_ptr[ i ].m_size;
+      }
+      return make_jagged_vector_layout< TYPE >( view.m_size, elements );
+   }
+
+   template< typename TYPE >
+   void pack_jagged_vector( const data::jagged_vector_view< TYPE >& from,
+                            const jagged_vector_layout& layout,
+                            void* target, void* base ) {
+
+      // The type of the views stored in the memory block.
+      typedef data::vector_view< std::remove_cv_t< TYPE > > view_type;
+
+      // Pointers to the payload in the target and the base memory blocks.
+      char* target_views = static_cast< char* >( target );
+      char* target_payload = target_views + layout.m_payload_offset;
+      std::remove_cv_t< TYPE >* base_payload =
+         reinterpret_cast< std::remove_cv_t< TYPE >* >(
+            static_cast< char* >( base ) + layout.m_payload_offset );
+
+      // Pack the inner vectors one by one.
+      for( std::size_t i = 0; i < from.m_size; ++i ) {
+         const std::size_t size = from.m_ptr[ i ].m_size;
+         const view_type view( size, base_payload );
+         std::memcpy( target_views + i * sizeof( view_type ), &view,
+                      sizeof( view_type ) );
+         if( size != 0 ) {
+            std::memcpy( target_payload, from.m_ptr[ i ].m_ptr,
+                         size * sizeof( TYPE ) );
+         }
+         target_payload += size * sizeof( TYPE );
+         base_payload += size;
+      }
+   }
+
+   template< typename TYPE >
+   void rebase_jagged_vector( data::vector_view< TYPE >* views,
+                              std::size_t rows, const void* old_base,
+                              void* new_base ) {
+
+      for( std::size_t i = 0; i < rows; ++i ) {
+         const std::ptrdiff_t offset =
+            reinterpret_cast< const char* >( views[ i ].m_ptr ) -
+            static_cast< const char* >( old_base );
+         views[ i ].m_ptr = reinterpret_cast< TYPE* >(
+            static_cast< char* >( new_base ) + offset );
+      }
+   }
+
+} // namespace vecmem::details
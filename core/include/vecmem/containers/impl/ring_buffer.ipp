@@ -0,0 +1,149 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/device_ring_buffer.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <thread>
+
+namespace vecmem {
+
+   namespace details {
+
+      /// Size of the cache lines that the buffer's counters are aligned to
+      static constexpr std::size_t ring_buffer_cache_line = 64;
+
+      /// Round a requested capacity up to the next power of 2
+      ///
+      /// The sequence numbers of the slots can only tell a written slot from
+      /// a free one with at least 2 slots, so that is the smallest capacity.
+      ///
+      inline std::size_t ring_buffer_capacity( std::size_t requested ) {
+
+         std::size_t result = 2;
+         while( result < requested ) {
+            result <<= 1;
+         }
+         return result;
+      }
+
+   } // namespace details
+
+   template< typename TYPE >
+   VECMEM_HOST
+   ring_buffer< TYPE >::ring_buffer( size_type capacity,
+                                     memory_resource& resource )
+   : m_data(), m_memory( nullptr, { 0, resource } ) {
+
+      // Lay out the buffer: the two counters a cache line apart, followed by
+      // the sequence numbers and the elements.
+      static constexpr std::size_t line = details::ring_buffer_cache_line;
+      static_assert( alignof( TYPE ) <= alignof( std::max_align_t ),
+                     "Over-aligned types are not supported" );
+      const size_type slots = details::ring_buffer_capacity( capacity );
+      const std::size_t sequences_offset = 2 * line;
+      const std::size_t elements_offset =
+         ( ( sequences_offset + slots * sizeof( size_type ) + line - 1 ) /
+           line ) * line;
+      const std::size_t bytes = elements_offset + slots * sizeof( TYPE );
+
+      // Allocate the memory.
+      m_memory = std::unique_ptr< char, details::deallocator >(
+         static_cast< char* >( resource.allocate( bytes ) ),
+         { bytes, resource } );
+      char* ptr = m_memory.get();
+      m_data = data::ring_buffer_view< TYPE >(
+         slots, reinterpret_cast< size_type* >( ptr ),
+         reinterpret_cast< size_type* >( ptr + line ),
+         reinterpret_cast< size_type* >( ptr + sequences_offset ),
+         reinterpret_cast< TYPE* >( ptr + elements_offset ) );
+
+      // Initialise the counters and the sequence numbers.
+      *( m_data.m_head ) = 0;
+      *( m_data.m_tail ) = 0;
+      for( size_type i = 0; i < slots; ++i ) {
+         m_data.m_sequences[ i ] = i;
+      }
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   bool ring_buffer< TYPE >::try_push( const_reference value ) {
+
+      return device_ring_buffer< TYPE >( m_data ).try_push( value );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   bool ring_buffer< TYPE >::try_pop( value_type& value ) {
+
+      return device_ring_buffer< TYPE >( m_data ).try_pop( value );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   void ring_buffer< TYPE >::push( const_reference value ) {
+
+      device_ring_buffer< TYPE > buffer( m_data );
+      while( ! buffer.try_push( value ) ) {
+         std::this_thread::yield();
+      }
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   typename ring_buffer< TYPE >::value_type ring_buffer< TYPE >::pop() {
+
+      device_ring_buffer< TYPE > buffer( m_data );
+      value_type result;
+      while( ! buffer.try_pop( result ) ) {
+         std::this_thread::yield();
+      }
+      return result;
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   bool ring_buffer< TYPE >::empty() const {
+
+      return ( size() == 0 );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   typename ring_buffer< TYPE >::size_type ring_buffer< TYPE >::size() const {
+
+      return device_ring_buffer< TYPE >( m_data ).size();
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   typename ring_buffer< TYPE >::size_type
+   ring_buffer< TYPE >::capacity() const {
+
+      return m_data.m_capacity;
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   const data::ring_buffer_view< TYPE >& ring_buffer< TYPE >::data() const {
+
+      return m_data;
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   data::ring_buffer_view< TYPE >
+   get_data( ring_buffer< TYPE >& buffer ) {
+
+      return buffer.data();
+   }
+
+} // namespace vecmem
@@ -0,0 +1,21 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem { namespace data {
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   ring_buffer_view< TYPE >::
+   ring_buffer_view( size_type capacity, size_type* head, size_type* tail,
+                     size_type* sequences, pointer elements )
+   : m_capacity( capacity ), m_head( head ), m_tail( tail ),
+     m_sequences( sequences ), m_elements( elements ) {
+
+   }
+
+} } // namespace vecmem::data
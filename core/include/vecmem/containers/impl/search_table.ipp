@@ -0,0 +1,92 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/device_search_table.hpp"
+
+namespace vecmem {
+
+   template< typename TYPE >
+   VECMEM_HOST
+   search_table< TYPE >::
+   search_table( const data::vector_view< const TYPE >& sorted,
+                 memory_resource& resource )
+   : m_keys( sorted.m_size + 1, resource ),
+     m_indices( sorted.m_size + 1, resource ) {
+
+      // The element not in the tree represents the "end" of the array.
+      m_indices.m_ptr[ 0 ] = sorted.m_size;
+
+      // Re-arrange the elements.
+      size_type sorted_index = 0;
+      fill( sorted, sorted_index, 1 );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   typename search_table< TYPE >::size_type
+   search_table< TYPE >::lower_bound( const_reference value ) const {
+
+      return device_search_table< TYPE >( data() ).lower_bound( value );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   typename search_table< TYPE >::size_type
+   search_table< TYPE >::find( const_reference value ) const {
+
+      return device_search_table< TYPE >( data() ).find( value );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   bool search_table< TYPE >::empty() const {
+
+      return ( size() == 0 );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   typename search_table< TYPE >::size_type
+   search_table< TYPE >::size() const {
+
+      return ( m_keys.m_size - 1 );
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   data::search_table_view< TYPE > search_table< TYPE >::data() const {
+
+      return { size(), m_keys.m_ptr, m_indices.m_ptr };
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   void search_table< TYPE >::
+   fill( const data::vector_view< const TYPE >& sorted,
+         size_type& sorted_index, size_type k ) {
+
+      // The recursion depth is only logarithmic in the size of the table.
+      if( k <= sorted.m_size ) {
+         fill( sorted, sorted_index, 2 * k );
+         m_keys.m_ptr[ k ] = sorted.m_ptr[ sorted_index ];
+         m_indices.m_ptr[ k ] = sorted_index;
+         ++sorted_index;
+         fill( sorted, sorted_index, 2 * k + 1 );
+      }
+   }
+
+   template< typename TYPE >
+   VECMEM_HOST
+   data::search_table_view< TYPE >
+   get_data( const search_table< TYPE >& table ) {
+
+      return table.data();
+   }
+
+} // namespace vecmem
@@ -0,0 +1,19 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem { namespace data {
+
+   template< typename TYPE >
+   VECMEM_HOST_AND_DEVICE
+   search_table_view< TYPE >::
+   search_table_view( size_type size, pointer keys, const size_type* indices )
+   : m_size( size ), m_keys( keys ), m_indices( indices ) {
+
+   }
+
+} } // namespace vecmem::data
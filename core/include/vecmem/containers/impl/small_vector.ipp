@@ -0,0 +1,620 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace vecmem {
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   small_vector< TYPE, N >::small_vector( memory_resource* resource )
+   : m_resource( resource != nullptr ? resource :
+                 polymorphic_allocator< char >().resource() ),
+     m_data( inline_data() ), m_size( 0 ), m_capacity( N ) {
+
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   small_vector< TYPE, N >::small_vector( size_type size,
+                                          const_reference value,
+                                          memory_resource* resource )
+   : small_vector( resource ) {
+
+      resize( size, value );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   small_vector< TYPE, N >::
+   small_vector( std::initializer_list< value_type > values,
+                 memory_resource* resource )
+   : small_vector( resource ) {
+
+      reserve( values.size() );
+      std::uninitialized_copy( values.begin(), values.end(), m_data );
+      m_size = values.size();
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   small_vector< TYPE, N >::small_vector( const small_vector& parent )
+   : small_vector( parent.m_resource ) {
+
+      reserve( parent.m_size );
+      std::uninitialized_copy( parent.begin(), parent.end(), m_data );
+      m_size = parent.m_size;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   small_vector< TYPE, N >::small_vector( small_vector&& parent )
+   : small_vector( parent.m_resource ) {
+
+      if( parent.is_inline() ) {
+         // Inline elements need to be moved one by one.
+         move_elements( parent.m_data, parent.m_size, m_data );
+      } else {
+         // Allocated memory can just be taken over.
+         m_data = parent.m_data;
+         m_capacity = parent.m_capacity;
+         parent.m_data = parent.inline_data();
+         parent.m_capacity = N;
+      }
+      m_size = parent.m_size;
+      parent.m_size = 0;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   small_vector< TYPE, N >::~small_vector() {
+
+      clear();
+      deallocate();
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   small_vector< TYPE, N >&
+   small_vector< TYPE, N >::operator=( const small_vector& rhs ) {
+
+      // Avoid self-assignment.
+      if( this == &rhs ) {
+         return *this;
+      }
+
+      // Replace the current elements with copies of the other vector's.
+      clear();
+      reserve( rhs.m_size );
+      std::uninitialized_copy( rhs.begin(), rhs.end(), m_data );
+      m_size = rhs.m_size;
+      return *this;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   small_vector< TYPE, N >&
+   small_vector< TYPE, N >::operator=( small_vector&& rhs ) {
+
+      // Avoid self-assignment.
+      if( this == &rhs ) {
+         return *this;
+      }
+
+      // Get rid of the current elements.
+      clear();
+
+      // Take over the memory of the other vector if possible, and move its
+      // elements one by one otherwise.
+      if( ( ! rhs.is_inline() ) && ( *m_resource == *( rhs.m_resource ) ) ) {
+         deallocate();
+         m_data = rhs.m_data;
+         m_capacity = rhs.m_capacity;
+         rhs.m_data = rhs.inline_data();
+         rhs.m_capacity = N;
+      } else {
+         reserve( rhs.m_size );
+         move_elements( rhs.m_data, rhs.m_size, m_data );
+      }
+      m_size = rhs.m_size;
+      rhs.m_size = 0;
+      return *this;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::reference
+   small_vector< TYPE, N >::at( size_type pos ) {
+
+      // Make sure that the element exists.
+      if( pos >= m_size ) {
+         throw std::out_of_range( "Requested element " + std::to_string( pos ) +
+                                  " from a " + std::to_string( m_size ) +
+                                  " sized vecmem::small_vector" );
+      }
+
+      // Return the element.
+      return m_data[ pos ];
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_reference
+   small_vector< TYPE, N >::at( size_type pos ) const {
+
+      // Make sure that the element exists.
+      if( pos >= m_size ) {
+         throw std::out_of_range( "Requested element " + std::to_string( pos ) +
+                                  " from a " + std::to_string( m_size ) +
+                                  " sized vecmem::small_vector" );
+      }
+
+      // Return the element.
+      return m_data[ pos ];
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::reference
+   small_vector< TYPE, N >::operator[]( size_type pos ) {
+
+      return m_data[ pos ];
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_reference
+   small_vector< TYPE, N >::operator[]( size_type pos ) const {
+
+      return m_data[ pos ];
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::reference
+   small_vector< TYPE, N >::front() {
+
+      // Make sure that the element exists.
+      assert( m_size > 0 );
+
+      // Return the element.
+      return m_data[ 0 ];
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_reference
+   small_vector< TYPE, N >::front() const {
+
+      // Make sure that the element exists.
+      assert( m_size > 0 );
+
+      // Return the element.
+      return m_data[ 0 ];
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::reference
+   small_vector< TYPE, N >::back() {
+
+      // Make sure that the element exists.
+      assert( m_size > 0 );
+
+      // Return the element.
+      return m_data[ m_size - 1 ];
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_reference
+   small_vector< TYPE, N >::back() const {
+
+      // Make sure that the element exists.
+      assert( m_size > 0 );
+
+      // Return the element.
+      return m_data[ m_size - 1 ];
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::pointer
+   small_vector< TYPE, N >::data() {
+
+      return m_data;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_pointer
+   small_vector< TYPE, N >::data() const {
+
+      return m_data;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::iterator
+   small_vector< TYPE, N >::insert( const_iterator pos,
+                                    const_reference value ) {
+
+      // Find the index of the new element.
+      const size_type index = static_cast< size_type >( pos - m_data );
+      assert( index <= m_size );
+
+      // Inserting at the end is simple.
+      if( index == m_size ) {
+         emplace_back( value );
+         return m_data + index;
+      }
+
+      // Take a copy of the value, as it may be an element of this vector.
+      value_type copy( value );
+      // Shift all elements after the insertion point by one.
+      emplace_back( std::move( back() ) );
+      std::move_backward( m_data + index, m_data + m_size - 2,
+                          m_data + m_size - 1 );
+      // Set the new element.
+      m_data[ index ] = std::move( copy );
+      return m_data + index;
+   }
+
+   template< typename TYPE, std::size_t N >
+   template< typename... Args >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::reference
+   small_vector< TYPE, N >::emplace_back( Args&&... args ) {
+
+      // If there is space for the new element, simply construct it.
+      if( m_size < m_capacity ) {
+         new( m_data + m_size ) value_type( std::forward< Args >( args )... );
+         return m_data[ m_size++ ];
+      }
+
+      // If not, allocate a larger memory block, and construct the new element
+      // there first. As the arguments may refer to elements of this vector.
+      const size_type new_cap = grown_capacity( m_size + 1 );
+      pointer new_data = static_cast< pointer >(
+         m_resource->allocate( new_cap * sizeof( TYPE ), alignof( TYPE ) ) );
+      try {
+         new( new_data + m_size ) value_type( std::forward< Args >( args )... );
+      } catch( ... ) {
+         m_resource->deallocate( new_data, new_cap * sizeof( TYPE ),
+                                 alignof( TYPE ) );
+         throw;
+      }
+
+      // Move the existing elements to the new memory block.
+      move_elements( m_data, m_size, new_data );
+      deallocate();
+      m_data = new_data;
+      m_capacity = new_cap;
+      return m_data[ m_size++ ];
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::push_back( const_reference value ) {
+
+      emplace_back( value );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::push_back( value_type&& value ) {
+
+      emplace_back( std::move( value ) );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::iterator
+   small_vector< TYPE, N >::erase( const_iterator pos ) {
+
+      return erase( pos, pos + 1 );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::iterator
+   small_vector< TYPE, N >::erase( const_iterator first,
+                                   const_iterator last ) {
+
+      // Find the indices of the range.
+      const size_type first_index = static_cast< size_type >( first - m_data );
+      const size_type last_index = static_cast< size_type >( last - m_data );
+      assert( first_index <= last_index );
+      assert( last_index <= m_size );
+
+      // Move the elements after the range forward, and destroy the ones left
+      // behind at the end.
+      std::move( m_data + last_index, m_data + m_size, m_data + first_index );
+      const size_type new_size = m_size - ( last_index - first_index );
+      for( size_type i = new_size; i < m_size; ++i ) {
+         m_data[ i ].~value_type();
+      }
+      m_size = new_size;
+      return m_data + first_index;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::pop_back() {
+
+      // Make sure that there is an element to remove.
+      assert( m_size > 0 );
+
+      // Remove the element.
+      m_data[ --m_size ].~value_type();
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::clear() {
+
+      if( ! std::is_trivially_destructible< value_type >::value ) {
+         for( size_type i = 0; i < m_size; ++i ) {
+            m_data[ i ].~value_type();
+         }
+      }
+      m_size = 0;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::resize( size_type new_size ) {
+
+      // Remove elements, if the vector is shrinking.
+      if( new_size <= m_size ) {
+         erase( m_data + new_size, m_data + m_size );
+         return;
+      }
+
+      // Construct new elements, if it's growing.
+      reserve( new_size );
+      for( size_type i = m_size; i < new_size; ++i ) {
+         new( m_data + i ) value_type();
+      }
+      m_size = new_size;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::resize( size_type new_size,
+                                         const_reference value ) {
+
+      // Remove elements, if the vector is shrinking.
+      if( new_size <= m_size ) {
+         erase( m_data + new_size, m_data + m_size );
+         return;
+      }
+
+      // Construct new elements, if it's growing. Taking a copy of the value
+      // first, as it may be an element of this vector.
+      const value_type copy( value );
+      reserve( new_size );
+      std::uninitialized_fill( m_data + m_size, m_data + new_size, copy );
+      m_size = new_size;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::iterator
+   small_vector< TYPE, N >::begin() {
+
+      return m_data;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_iterator
+   small_vector< TYPE, N >::begin() const {
+
+      return m_data;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_iterator
+   small_vector< TYPE, N >::cbegin() const {
+
+      return begin();
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::iterator
+   small_vector< TYPE, N >::end() {
+
+      return m_data + m_size;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_iterator
+   small_vector< TYPE, N >::end() const {
+
+      return m_data + m_size;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_iterator
+   small_vector< TYPE, N >::cend() const {
+
+      return end();
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::reverse_iterator
+   small_vector< TYPE, N >::rbegin() {
+
+      return reverse_iterator( end() );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_reverse_iterator
+   small_vector< TYPE, N >::rbegin() const {
+
+      return const_reverse_iterator( end() );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::reverse_iterator
+   small_vector< TYPE, N >::rend() {
+
+      return reverse_iterator( begin() );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::const_reverse_iterator
+   small_vector< TYPE, N >::rend() const {
+
+      return const_reverse_iterator( begin() );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   bool small_vector< TYPE, N >::empty() const {
+
+      return ( m_size == 0 );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::size_type
+   small_vector< TYPE, N >::size() const {
+
+      return m_size;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::size_type
+   small_vector< TYPE, N >::capacity() const {
+
+      return m_capacity;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::reserve( size_type new_cap ) {
+
+      if( new_cap > m_capacity ) {
+         reallocate( new_cap );
+      }
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   bool small_vector< TYPE, N >::is_inline() const {
+
+      return ( m_data == reinterpret_cast< const_pointer >( m_inline ) );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   memory_resource* small_vector< TYPE, N >::resource() const {
+
+      return m_resource;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::pointer
+   small_vector< TYPE, N >::inline_data() {
+
+      return reinterpret_cast< pointer >( m_inline );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::reallocate( size_type new_cap ) {
+
+      // Allocate the new memory block.
+      assert( new_cap >= m_size );
+      pointer new_data = static_cast< pointer >(
+         m_resource->allocate( new_cap * sizeof( TYPE ), alignof( TYPE ) ) );
+
+      // Move the elements into it, and release the old one.
+      move_elements( m_data, m_size, new_data );
+      deallocate();
+      m_data = new_data;
+      m_capacity = new_cap;
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::deallocate() {
+
+      if( ! is_inline() ) {
+         m_resource->deallocate( m_data, m_capacity * sizeof( TYPE ),
+                                 alignof( TYPE ) );
+         m_data = inline_data();
+         m_capacity = N;
+      }
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   typename small_vector< TYPE, N >::size_type
+   small_vector< TYPE, N >::grown_capacity( size_type min_cap ) const {
+
+      return std::max( 2 * m_capacity, min_cap );
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   void small_vector< TYPE, N >::move_elements( pointer from, size_type n,
+                                                pointer to ) {
+
+      if( std::is_trivially_copyable< value_type >::value ) {
+         // Trivial types can be moved with a single memory copy.
+         if( n != 0 ) {
+            std::memcpy( static_cast< void* >( to ), from,
+                         n * sizeof( TYPE ) );
+         }
+      } else {
+         // Everything else needs to be moved one by one.
+         for( size_type i = 0; i < n; ++i ) {
+            new( to + i ) value_type( std::move( from[ i ] ) );
+            from[ i ].~value_type();
+         }
+      }
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   data::vector_view< TYPE >
+   get_data( small_vector< TYPE, N >& vec ) {
+
+      return { vec.size(), vec.data() };
+   }
+
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   data::vector_view< const TYPE >
+   get_data( const small_vector< TYPE, N >& vec ) {
+
+      return { vec.size(), vec.data() };
+   }
+
+} // namespace vecmem
@@ -24,7 +24,7 @@ namespace vecmem {
    VECMEM_HOST_AND_DEVICE
    static_vector< TYPE, MAX_SIZE >::
    static_vector( size_type size, const_reference value )
-   : m_size( size ), m_elements() {
+   : m_size( 0 ), m_elements() {
 
       assign( size, value );
    }
@@ -33,12 +33,29 @@ namespace vecmem {
    VECMEM_HOST_AND_DEVICE
    static_vector< TYPE, MAX_SIZE >::
    static_vector( const static_vector& parent )
-   : m_size( parent.m_size ), m_elements() {
+   : m_size( 0 ), m_elements() {
 
       // Make copies of all of the elements.
-      for( size_type i = 0; i < m_size; ++i ) {
-         construct( i, parent[ i ] );
+      copy_payload( parent.data(), parent.m_size );
+      m_size = parent.m_size;
+   }
+
+   template< typename TYPE, std::size_t MAX_SIZE >
+   VECMEM_HOST_AND_DEVICE
+   static_vector< TYPE, MAX_SIZE >::
+   static_vector( static_vector&& parent )
+   : m_size( 0 ), m_elements() {
+
+      // Take over all of the elements of the parent.
+      if constexpr( std::is_trivially_copyable< value_type >::value ) {
+         copy_payload( parent.data(), parent.m_size );
+      } else {
+         for( size_type i = 0; i < parent.m_size; ++i ) {
+            new( data() + i ) value_type( std::move( parent[ i ] ) );
+         }
       }
+      m_size = parent.m_size;
+      parent.clear();
    }
 
    template< typename TYPE, std::size_t MAX_SIZE >
@@ -48,6 +65,47 @@ namespace vecmem {
       clear();
    }
 
+   template< typename TYPE, std::size_t MAX_SIZE >
+   VECMEM_HOST_AND_DEVICE
+   static_vector< TYPE, MAX_SIZE >&
+   static_vector< TYPE, MAX_SIZE >::operator=( const static_vector& rhs ) {
+
+      // Avoid self-assignment.
+      if( this == &rhs ) {
+         return *this;
+      }
+
+      // Replace the current elements with copies of the other vector's.
+      clear();
+      copy_payload( rhs.data(), rhs.m_size );
+      m_size = rhs.m_size;
+      return *this;
+   }
+
+   template< typename TYPE, std::size_t MAX_SIZE >
+   VECMEM_HOST_AND_DEVICE
+   static_vector< TYPE, MAX_SIZE >&
+   static_vector< TYPE, MAX_SIZE >::operator=( static_vector&& rhs ) {
+
+      // Avoid self-assignment.
+      if( this == &rhs ) {
+         return *this;
+      }
+
+      // Replace the current elements with the other vector's.
+      clear();
+      if constexpr( std::is_trivially_copyable< value_type >::value ) {
+         copy_payload( rhs.data(), rhs.m_size );
+      } else {
+         for( size_type i = 0; i < rhs.m_size; ++i ) {
+            new( data() + i ) value_type( std::move( rhs[ i ] ) );
+         }
+      }
+      m_size = rhs.m_size;
+      rhs.clear();
+      return *this;
+   }
+
    template< typename TYPE, std::size_t MAX_SIZE >
    VECMEM_HOST_AND_DEVICE
    typename static_vector< TYPE, MAX_SIZE >::reference
@@ -186,13 +244,14 @@ namespace vecmem {
       // Find the index of this iterator inside of the vector.
       auto id = element_id( pos );
 
+      // Take a copy of the value, as it may be an element of this vector.
+      const value_type copy( value );
+
       // Move the payload of the existing elements after "pos".
-      memmove( static_cast< void* >( id.m_ptr + 1 ),
-               static_cast< const void* >( id.m_ptr ),
-               ( m_size - id.m_index ) * value_size );
+      relocate( id.m_index, id.m_index + 1, m_size - id.m_index );
 
       // Instantiate the new value.
-      construct( id.m_index, value );
+      construct( id.m_index, copy );
 
       // Increment the size.
       ++m_size;
@@ -213,14 +272,15 @@ namespace vecmem {
       // Find the index of this iterator inside of the vector.
       auto id = element_id( pos );
 
+      // Take a copy of the value, as it may be an element of this vector.
+      const value_type copy( value );
+
       // Move the payload of the existing elements after "pos".
-      memmove( static_cast< void* >( id.m_ptr + count ),
-               static_cast< const void* >( id.m_ptr ),
-               ( m_size - id.m_index ) * value_size );
+      relocate( id.m_index, id.m_index + count, m_size - id.m_index );
 
       // Instantiate all the new values.
       for( size_type i = 0; i < count; ++i ) {
-         construct( id.m_index + i, value );
+         construct( id.m_index + i, copy );
       }
 
       // Increment the size.
@@ -243,13 +303,15 @@ namespace vecmem {
       // Find the index of this iterator inside of the vector.
       auto id = element_id( pos );
 
+      // Construct the new value first, as the arguments may refer to elements
+      // of this vector.
+      value_type value( std::forward< Args >( args )... );
+
       // Move the payload of the existing elements after "pos".
-      memmove( static_cast< void* >( id.m_ptr + 1 ),
-               static_cast< const void* >( id.m_ptr ),
-               ( m_size - id.m_index ) * value_size );
+      relocate( id.m_index, id.m_index + 1, m_size - id.m_index );
 
       // Instantiate the new value.
-      new( id.m_ptr ) value_type( std::forward< Args >( args )... );
+      new( id.m_ptr ) value_type( std::move( value ) );
 
       // Increment the size.
       ++m_size;
@@ -286,9 +348,7 @@ namespace vecmem {
       destruct( id.m_index );
 
       // Move up the payload of the elements from after the removed one.
-      memmove( static_cast< void* >( id.m_ptr ),
-               static_cast< const void* >( id.m_ptr + 1 ),
-               ( m_size - id.m_index - 1 ) * value_size );
+      relocate( id.m_index + 1, id.m_index, m_size - id.m_index - 1 );
 
       // Decrement the size.
       --m_size;
@@ -314,9 +374,8 @@ namespace vecmem {
       }
 
       // Move up the payload of the elements from after the removed range.
-      memmove( static_cast< void* >( first_id.m_ptr ),
-               static_cast< const void* >( last_id.m_ptr ),
-               ( m_size - last_id.m_index ) * value_size );
+      relocate( last_id.m_index, first_id.m_index,
+                m_size - last_id.m_index );
 
       // Decrease the size.
       m_size -= ( last_id.m_index - first_id.m_index );
@@ -336,8 +395,10 @@ namespace vecmem {
    VECMEM_HOST_AND_DEVICE
    void static_vector< TYPE, MAX_SIZE >::clear() {
 
-      for( size_type i = 0; i < m_size; ++i ) {
-         destruct( i );
+      if constexpr( ! std::is_trivially_destructible< value_type >::value ) {
+         for( size_type i = 0; i < m_size; ++i ) {
+            destruct( i );
+         }
       }
       m_size = 0;
    }
@@ -534,6 +595,65 @@ namespace vecmem {
       ptr->~value_type();
    }
 
+   template< typename TYPE, std::size_t MAX_SIZE >
+   VECMEM_HOST_AND_DEVICE
+   void static_vector< TYPE, MAX_SIZE >::
+   copy_payload( const_pointer from, size_type count ) {
+
+      // Make sure that the elements fit.
+      assert( count <= array_max_size );
+
+      if constexpr( std::is_trivially_copyable< value_type >::value ) {
+         // Trivial types can be copied in one go.
+         if( count != 0 ) {
+            memcpy( static_cast< void* >( m_elements ),
+                    static_cast< const void* >( from ), count * value_size );
+         }
+      } else {
+         // Everything else needs to be copied one by one.
+         for( size_type i = 0; i < count; ++i ) {
+            construct( i, from[ i ] );
+         }
+      }
+   }
+
+   template< typename TYPE, std::size_t MAX_SIZE >
+   VECMEM_HOST_AND_DEVICE
+   void static_vector< TYPE, MAX_SIZE >::
+   relocate( size_type from, size_type to, size_type count ) {
+
+      // Make sure that the elements fit.
+      assert( to + count <= array_max_size );
+
+      // Check if anything needs to be done.
+      if( ( from == to ) || ( count == 0 ) ) {
+         return;
+      }
+
+      pointer ptr = reinterpret_cast< pointer >( m_elements );
+      if constexpr( std::is_trivially_copyable< value_type >::value ) {
+         // Trivial types can be moved in one go.
+         memmove( static_cast< void* >( ptr + to ),
+                  static_cast< const void* >( ptr + from ),
+                  count * value_size );
+      } else {
+         // Everything else needs to be moved one by one, in an order that
+         // would not overwrite elements that were not moved yet.
+         if( to < from ) {
+            for( size_type i = 0; i < count; ++i ) {
+               new( ptr + to + i ) value_type( std::move( ptr[ from + i ] ) );
+               ptr[ from + i ].~value_type();
+            }
+         } else {
+            for( size_type i = count; i > 0; --i ) {
+               new( ptr + to + i - 1 )
+                  value_type( std::move( ptr[ from + i - 1 ] ) );
+               ptr[ from + i - 1 ].~value_type();
+            }
+         }
+      }
+   }
+
    template< typename TYPE, std::size_t MAX_SIZE >
    VECMEM_HOST_AND_DEVICE
    typename static_vector< TYPE, MAX_SIZE >::ElementId
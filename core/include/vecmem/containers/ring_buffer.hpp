@@ -0,0 +1,118 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/ring_buffer_view.hpp"
+#include "vecmem/memory/deallocator.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace vecmem {
+
+   /// Bounded, lock-free multi-producer/multi-consumer queue
+   ///
+   /// This is the "host type" of the ring buffer, which owns its memory. All
+   /// of the memory is allocated at construction, so passing elements (like
+   /// @c vecmem::data::vector_view objects) through the buffer does not
+   /// allocate any memory. The producer and consumer counters are placed on
+   /// separate cache lines, so that producers and consumers would not slow
+   /// each other down.
+   ///
+   /// The memory resource needs to provide host accessible memory.
+   ///
+   template< typename TYPE >
+   class ring_buffer {
+
+   public:
+      /// Make sure that elements can be copied in and out of the buffer
+      static_assert( std::is_trivially_copyable< TYPE >::value,
+                     "vecmem::ring_buffer can only hold trivially copyable "
+                     "types" );
+
+      /// Type of the buffer elements
+      typedef TYPE              value_type;
+      /// Size type for the buffer
+      typedef std::size_t       size_type;
+      /// Constant value reference type
+      typedef const value_type& const_reference;
+
+      /// Constructor with a capacity and a memory resource
+      ///
+      /// The capacity is rounded up to the next power of 2, and is at
+      /// least 2.
+      ///
+      VECMEM_HOST
+      ring_buffer( size_type capacity, memory_resource& resource );
+
+      /// @name Element insertion/removal functions
+      /// @{
+
+      /// Try to add an element to the buffer
+      ///
+      /// @return @c false if the buffer was full, @c true otherwise
+      ///
+      VECMEM_HOST
+      bool try_push( const_reference value );
+      /// Try to take an element from the buffer
+      ///
+      /// @return @c false if the buffer was empty, @c true otherwise
+      ///
+      VECMEM_HOST
+      bool try_pop( value_type& value );
+
+      /// Add an element to the buffer, waiting for a free slot if necessary
+      VECMEM_HOST
+      void push( const_reference value );
+      /// Take an element from the buffer, waiting for one if necessary
+      VECMEM_HOST
+      value_type pop();
+
+      /// @}
+
+      /// @name Capacity checking functions
+      /// @{
+
+      /// Check whether the buffer is (approximately) empty
+      VECMEM_HOST
+      bool empty() const;
+      /// Return the (approximate) number of elements in the buffer
+      VECMEM_HOST
+      size_type size() const;
+      /// Return the number of slots in the buffer
+      VECMEM_HOST
+      size_type capacity() const;
+
+      /// @}
+
+      /// Get a view of the buffer's data
+      VECMEM_HOST
+      const data::ring_buffer_view< TYPE >& data() const;
+
+   private:
+      /// The view of the buffer's data
+      data::ring_buffer_view< TYPE > m_data;
+      /// The memory owned by the buffer
+      std::unique_ptr< char, details::deallocator > m_memory;
+
+   }; // class ring_buffer
+
+   /// Helper function creating a @c vecmem::data::ring_buffer_view object
+   template< typename TYPE >
+   VECMEM_HOST
+   data::ring_buffer_view< TYPE >
+   get_data( ring_buffer< TYPE >& buffer );
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/ring_buffer.ipp"
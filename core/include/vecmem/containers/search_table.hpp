@@ -0,0 +1,114 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/search_table_view.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem {
+
+   /// Static table for searching in a sorted array
+   ///
+   /// The table is built once from a sorted array, re-arranging its elements
+   /// into the Eytzinger layout described by
+   /// @c vecmem::data::search_table_view. Searching in this layout accesses
+   /// memory in a much more cache friendly way than a binary search in the
+   /// original array does. The results of the searches are indices into the
+   /// original array.
+   ///
+   /// The memory resource needs to provide host accessible memory. The table
+   /// can be searched on the host directly, or through
+   /// @c vecmem::device_search_table.
+   ///
+   template< typename TYPE >
+   class search_table {
+
+   public:
+      /// @name Type definitions
+      /// @{
+
+      /// Type of the table elements
+      typedef TYPE              value_type;
+      /// Size type for the table
+      typedef std::size_t       size_type;
+      /// Constant value reference type
+      typedef const value_type& const_reference;
+
+      /// @}
+
+      /// Construct the table from a sorted array
+      VECMEM_HOST
+      search_table( const data::vector_view< const TYPE >& sorted,
+                    memory_resource& resource );
+
+      /// @name Lookup functions
+      /// @{
+
+      /// Find the first element that is not less than a value
+      ///
+      /// @return The index of the element in the original, sorted array, or
+      ///         @c size() if all elements are less than the value
+      ///
+      VECMEM_HOST
+      size_type lower_bound( const_reference value ) const;
+
+      /// Find an element equal to a value
+      ///
+      /// @return The index of the element in the original, sorted array, or
+      ///         @c size() if no such element exists
+      ///
+      VECMEM_HOST
+      size_type find( const_reference value ) const;
+
+      /// @}
+
+      /// @name Capacity checking functions
+      /// @{
+
+      /// Check whether the table is empty
+      VECMEM_HOST
+      bool empty() const;
+      /// Return the number of elements in the table
+      VECMEM_HOST
+      size_type size() const;
+
+      /// @}
+
+      /// Get a view of the table's data
+      VECMEM_HOST
+      data::search_table_view< TYPE > data() const;
+
+   private:
+      /// Fill the sub-tree starting at a given index, in-order
+      VECMEM_HOST
+      void fill( const data::vector_view< const TYPE >& sorted,
+                 size_type& sorted_index, size_type k );
+
+      /// The elements, in Eytzinger order
+      data::vector_buffer< TYPE > m_keys;
+      /// The original indices of the elements, in Eytzinger order
+      data::vector_buffer< size_type > m_indices;
+
+   }; // class search_table
+
+   /// Helper function creating a @c vecmem::data::search_table_view object
+   template< typename TYPE >
+   VECMEM_HOST
+   data::search_table_view< TYPE >
+   get_data( const search_table< TYPE >& table );
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/search_table.ipp"
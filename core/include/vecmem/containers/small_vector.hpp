@@ -0,0 +1,304 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/polymorphic_allocator.hpp"
+#include "vecmem/utils/reverse_iterator.hpp"
+#include "vecmem/utils/type_traits.hpp"
+#include "vecmem/utils/types.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+
+namespace vecmem {
+
+   /// Class mimicking @c std::vector, with storage for a few elements inline
+   ///
+   /// Up to @c N elements are stored inside of the object itself, without
+   /// any memory allocation. Once the vector needs to grow beyond that, its
+   /// elements are moved into memory allocated from a @c vecmem::memory_resource.
+   /// This makes the type ideal for the many, typically very short lists used
+   /// in algorithms like clustering.
+   ///
+   /// The memory resource needs to provide host accessible memory.
+   ///
+   template< typename TYPE, std::size_t N >
+   class small_vector {
+
+   public:
+      /// Make sure that some inline storage is requested
+      static_assert( N > 0, "vecmem::small_vector needs inline storage for "
+                            "at least one element. Use vecmem::vector "
+                            "otherwise." );
+
+      /// @name Type definitions, mimicking @c std::vector
+      /// @{
+
+      /// Type of the array elements
+      typedef TYPE               value_type;
+      /// Size type for the array
+      typedef std::size_t        size_type;
+      /// Pointer difference type
+      typedef std::ptrdiff_t     difference_type;
+
+      /// The number of elements stored inline
+      static constexpr size_type inline_capacity = N;
+
+      /// Value reference type
+      typedef value_type&        reference;
+      /// Constant value reference type
+      typedef const value_type&  const_reference;
+      /// Value pointer type
+      typedef value_type*        pointer;
+      /// Constant value pointer type
+      typedef const value_type*  const_pointer;
+
+      /// Forward iterator type
+      typedef pointer            iterator;
+      /// Constant forward iterator type
+      typedef const_pointer      const_iterator;
+      /// Reverse iterator type
+      typedef vecmem::reverse_iterator< iterator >       reverse_iterator;
+      /// Constant reverse iterator type
+      typedef vecmem::reverse_iterator< const_iterator > const_reverse_iterator;
+
+      /// @}
+
+      /// @name Constructors and destructor, mimicking @c std::vector
+      /// @{
+
+      /// Default constructor
+      ///
+      /// @param resource The memory resource to use once the vector outgrows
+      ///                 its inline storage. The default memory resource is
+      ///                 used if a null pointer is given.
+      ///
+      VECMEM_HOST
+      small_vector( memory_resource* resource = nullptr );
+      /// Construct a vector with a specific size
+      VECMEM_HOST
+      small_vector( size_type size, const_reference value = value_type(),
+                    memory_resource* resource = nullptr );
+      /// Construct a vector from an initializer list
+      VECMEM_HOST
+      small_vector( std::initializer_list< value_type > values,
+                    memory_resource* resource = nullptr );
+      /// Copy constructor, using the same memory resource as the parent
+      VECMEM_HOST
+      small_vector( const small_vector& parent );
+      /// Move constructor
+      VECMEM_HOST
+      small_vector( small_vector&& parent );
+
+      /// Destructor
+      VECMEM_HOST
+      ~small_vector();
+
+      /// Copy assignment operator
+      VECMEM_HOST
+      small_vector& operator=( const small_vector& rhs );
+      /// Move assignment operator
+      VECMEM_HOST
+      small_vector& operator=( small_vector&& rhs );
+
+      /// @}
+
+      /// @name Vector element access functions
+      /// @{
+
+      /// Return a specific element of the vector in a "safe way" (non-const)
+      VECMEM_HOST
+      reference at( size_type pos );
+      /// Return a specific element of the vector in a "safe way" (const)
+      VECMEM_HOST
+      const_reference at( size_type pos ) const;
+
+      /// Return a specific element of the vector (non-const)
+      VECMEM_HOST
+      reference operator[]( size_type pos );
+      /// Return a specific element of the vector (const)
+      VECMEM_HOST
+      const_reference operator[]( size_type pos ) const;
+
+      /// Return the first element of the vector (non-const)
+      VECMEM_HOST
+      reference front();
+      /// Return the first element of the vector (const)
+      VECMEM_HOST
+      const_reference front() const;
+
+      /// Return the last element of the vector (non-const)
+      VECMEM_HOST
+      reference back();
+      /// Return the last element of the vector (const)
+      VECMEM_HOST
+      const_reference back() const;
+
+      /// Access the underlying memory array (non-const)
+      VECMEM_HOST
+      pointer data();
+      /// Access the underlying memory array (const)
+      VECMEM_HOST
+      const_pointer data() const;
+
+      /// @}
+
+      /// @name Payload modification functions
+      /// @{
+
+      /// Insert a new element into the vector
+      VECMEM_HOST
+      iterator insert( const_iterator pos, const_reference value );
+      /// Add a new element at the end of the vector
+      template< typename... Args >
+      VECMEM_HOST
+      reference emplace_back( Args&&... args );
+      /// Add a new element at the end of the vector
+      VECMEM_HOST
+      void push_back( const_reference value );
+      /// Add a new element at the end of the vector
+      VECMEM_HOST
+      void push_back( value_type&& value );
+
+      /// Remove one element from the vector
+      VECMEM_HOST
+      iterator erase( const_iterator pos );
+      /// Remove a list of elements from the vector
+      VECMEM_HOST
+      iterator erase( const_iterator first, const_iterator last );
+      /// Remove the last element of the vector
+      VECMEM_HOST
+      void pop_back();
+
+      /// Clear the vector
+      VECMEM_HOST
+      void clear();
+      /// Resize the vector
+      VECMEM_HOST
+      void resize( size_type new_size );
+      /// Resize the vector and fill any new elements with the specified value
+      VECMEM_HOST
+      void resize( size_type new_size, const_reference value );
+
+      /// @}
+
+      /// @name Iterator providing functions
+      /// @{
+
+      /// Return a forward iterator pointing at the beginning of the vector
+      VECMEM_HOST
+      iterator begin();
+      /// Return a constant forward iterator pointing at the beginning of the vector
+      VECMEM_HOST
+      const_iterator begin() const;
+      /// Return a constant forward iterator pointing at the beginning of the vector
+      VECMEM_HOST
+      const_iterator cbegin() const;
+
+      /// Return a forward iterator pointing at the end of the vector
+      VECMEM_HOST
+      iterator end();
+      /// Return a constant forward iterator pointing at the end of the vector
+      VECMEM_HOST
+      const_iterator end() const;
+      /// Return a constant forward iterator pointing at the end of the vector
+      VECMEM_HOST
+      const_iterator cend() const;
+
+      /// Return a reverse iterator pointing at the end of the vector
+      VECMEM_HOST
+      reverse_iterator rbegin();
+      /// Return a constant reverse iterator pointing at the end of the vector
+      VECMEM_HOST
+      const_reverse_iterator rbegin() const;
+
+      /// Return a reverse iterator pointing at the beginning of the vector
+      VECMEM_HOST
+      reverse_iterator rend();
+      /// Return a constant reverse iterator pointing at the beginning of the vector
+      VECMEM_HOST
+      const_reverse_iterator rend() const;
+
+      /// @}
+
+      /// @name Capacity checking/modyfying functions
+      /// @{
+
+      /// Check whether the vector is empty
+      VECMEM_HOST
+      bool empty() const;
+      /// Return the number of elements in the vector
+      VECMEM_HOST
+      size_type size() const;
+      /// Return the number of elements that the vector can hold currently
+      VECMEM_HOST
+      size_type capacity() const;
+      /// Reserve storage for (at least) the specified number of elements
+      VECMEM_HOST
+      void reserve( size_type new_cap );
+      /// Check whether the elements are stored inline at the moment
+      VECMEM_HOST
+      bool is_inline() const;
+
+      /// Get the memory resource used once the inline storage is outgrown
+      VECMEM_HOST
+      memory_resource* resource() const;
+
+      /// @}
+
+   private:
+      /// Get a pointer to the inline storage
+      VECMEM_HOST
+      pointer inline_data();
+      /// Move the elements into a memory block with the specified capacity
+      VECMEM_HOST
+      void reallocate( size_type new_cap );
+      /// Release the allocated memory (if any), after the elements were
+      /// destroyed or moved away
+      VECMEM_HOST
+      void deallocate();
+      /// Get the capacity to grow to, to fit the requested number of elements
+      VECMEM_HOST
+      size_type grown_capacity( size_type min_cap ) const;
+      /// Move elements into uninitialised memory, destroying the originals
+      VECMEM_HOST
+      static void move_elements( pointer from, size_type n, pointer to );
+
+      /// The memory resource used for large vectors
+      memory_resource* m_resource;
+      /// Pointer to the elements (either inline, or on the "heap")
+      pointer m_data;
+      /// The number of elements in the vector
+      size_type m_size;
+      /// The number of elements that fit into the current storage
+      size_type m_capacity;
+      /// The inline storage of the vector
+      alignas( TYPE ) char m_inline[ N * sizeof( TYPE ) ];
+
+   }; // class small_vector
+
+   /// Helper function creating a @c vecmem::data::vector_view object
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   data::vector_view< TYPE >
+   get_data( small_vector< TYPE, N >& vec );
+
+   /// Helper function creating a @c vecmem::data::vector_view object
+   template< typename TYPE, std::size_t N >
+   VECMEM_HOST
+   data::vector_view< const TYPE >
+   get_data( const small_vector< TYPE, N >& vec );
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/containers/impl/small_vector.ipp"
@@ -0,0 +1,44 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/default_init_allocator.hpp"
+#include "vecmem/memory/static_allocator.hpp"
+
+// System include(s).
+#include <vector>
+
+namespace vecmem {
+
+   /// Alias type for vectors using a memory resource known at compile time
+   ///
+   /// This type behaves like @c vecmem::vector, but uses
+   /// @c vecmem::static_allocator instead of the polymorphic allocator. Which
+   /// allows the compiler to inline the allocations, if the resource type
+   /// allows for it. Objects of this type can be used with
+   /// @c vecmem::get_data the same way as @c vecmem::vector objects.
+   ///
+   /// @warning This type should only be used with host-accessible memory
+   /// resources.
+   ///
+   template< typename T, typename RESOURCE >
+   using static_resource_vector =
+      std::vector< T, static_allocator< T, RESOURCE > >;
+
+   /// Alias type for vectors using a memory resource known at compile time,
+   /// which do not zero-fill their new elements
+   ///
+   /// @see vecmem::default_init_vector
+   ///
+   template< typename T, typename RESOURCE >
+   using static_resource_default_init_vector =
+      std::vector< T, default_init_allocator<
+                         static_allocator< T, RESOURCE > > >;
+
+} // namespace vecmem
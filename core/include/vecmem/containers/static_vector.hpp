@@ -12,6 +12,7 @@
 #include "vecmem/utils/types.hpp"
 
 // System include(s).
+#include <cassert>
 #include <cstddef>
 #include <type_traits>
 
@@ -91,11 +92,21 @@ namespace vecmem {
       /// Copy constructor
       VECMEM_HOST_AND_DEVICE
       static_vector( const static_vector& parent );
+      /// Move constructor
+      VECMEM_HOST_AND_DEVICE
+      static_vector( static_vector&& parent );
 
       /// Destructor
       VECMEM_HOST_AND_DEVICE
       ~static_vector();
 
+      /// Copy assignment operator
+      VECMEM_HOST_AND_DEVICE
+      static_vector& operator=( const static_vector& rhs );
+      /// Move assignment operator
+      VECMEM_HOST_AND_DEVICE
+      static_vector& operator=( static_vector&& rhs );
+
       /// @}
 
       /// @name Vector element access functions
@@ -155,6 +166,20 @@ namespace vecmem {
          // Remove all previous elements.
          clear();
 
+         // Trivially copyable elements coming from a contiguous array can be
+         // copied in one go.
+         if constexpr( std::is_pointer< InputIt >::value &&
+                       std::is_same< std::remove_cv_t<
+                                        std::remove_pointer_t< InputIt > >,
+                                     value_type >::value &&
+                       std::is_trivially_copyable< value_type >::value ) {
+            const size_type count = other_end - other_begin;
+            assert( count <= array_max_size );
+            copy_payload( other_begin, count );
+            m_size = count;
+            return;
+         }
+
          // Create copies of all of the elements one-by-one. It's very
          // inefficient, but we can't make any assumptions about the type of the
          /// input iterator eceived by this function.
@@ -302,6 +327,17 @@ namespace vecmem {
       /// Destruct a vector element
       VECMEM_HOST_AND_DEVICE
       void destruct( size_type pos );
+      /// Copy-construct elements at the start of the (empty) array
+      VECMEM_HOST_AND_DEVICE
+      void copy_payload( const_pointer from, size_type count );
+      /// Move the payload of some elements to a different position
+      ///
+      /// The target range may overlap with the source range. The elements in
+      /// the source range are left destroyed/uninitialised, while the target
+      /// range must not hold live elements (outside of the source range).
+      ///
+      VECMEM_HOST_AND_DEVICE
+      void relocate( size_type from, size_type to, size_type count );
 
       /// Helper type for identifying an element in the
       struct ElementId {
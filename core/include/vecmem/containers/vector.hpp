@@ -8,6 +8,7 @@
 
 // Local include(s).
 #include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/memory/default_init_allocator.hpp"
 #include "vecmem/memory/polymorphic_allocator.hpp"
 
 // System include(s).
@@ -27,6 +28,23 @@ namespace vecmem {
    template<typename T>
    using vector = std::vector<T, vecmem::polymorphic_allocator<T>>;
 
+   /**
+    * @brief Alias type for vectors that do not zero-fill their new elements
+    *
+    * This type behaves the same way as @c vecmem::vector, but the elements
+    * created by its size-taking constructor and by @c resize(...) are only
+    * default-initialised. Meaning that elements of trivial types are left
+    * uninitialised. It is meant for large buffers that are fully overwritten
+    * right after their creation.
+    *
+    * @warning This type should only be used with host-accessible memory
+    * resources.
+    */
+   template<typename T>
+   using default_init_vector =
+      std::vector<T, vecmem::default_init_allocator<
+                        vecmem::polymorphic_allocator<T>>>;
+
    /// Helper function creating a @c vecmem::data::vector_view object
    template< typename TYPE, typename ALLOC >
    VECMEM_HOST
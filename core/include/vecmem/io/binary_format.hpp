@@ -0,0 +1,104 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace vecmem::io {
+
+   /// The kinds of data that a vecmem binary file can hold
+   enum class binary_content : std::uint32_t {
+      /// A 1-dimensional vector
+      vector = 0,
+      /// A jagged vector
+      jagged_vector = 1
+   }; // enum class binary_content
+
+   /// Header at the start of every vecmem binary file
+   ///
+   /// The header is followed by an array of @c m_rows + 1 64-bit offsets for
+   /// jagged vectors, describing where each inner vector starts in the
+   /// payload (in units of elements). The payload itself starts at the next
+   /// offset that is a multiple of @c vecmem::io::binary_payload_alignment,
+   /// and holds all of the elements contiguously.
+   ///
+   /// All numbers are stored in the native byte order of the host.
+   ///
+   struct binary_header {
+      /// Magic bytes identifying the file format
+      char m_magic[ 8 ];
+      /// Version of the file format
+      std::uint32_t m_version;
+      /// The type of content in the file
+      binary_content m_content;
+      /// The size of one element in bytes
+      std::uint64_t m_element_size;
+      /// The number of inner vectors (for jagged vectors)
+      std::uint64_t m_rows;
+      /// The total number of elements in the file
+      std::uint64_t m_elements;
+   }; // struct binary_header
+
+   /// Alignment of the payload in the binary files
+   static constexpr std::size_t binary_payload_alignment = 64;
+
+   namespace details {
+
+      /// Create a header for a file with the specified content
+      binary_header make_binary_header( binary_content content,
+                                        std::size_t element_size,
+                                        std::size_t rows,
+                                        std::size_t elements );
+
+      /// Check that a header describes the expected type of content
+      ///
+      /// @throws std::runtime_error if the header is not valid, or does not
+      ///         describe the expected type of content
+      ///
+      void check_binary_header( const binary_header& header,
+                                binary_content content,
+                                std::size_t element_size );
+
+      /// Check that the offsets of a jagged vector are consistent
+      ///
+      /// The offsets need to start at zero, never decrease, and end at the
+      /// number of elements declared in the header.
+      ///
+      /// @throws std::runtime_error if the offsets are not consistent
+      ///
+      void check_binary_offsets( const binary_header& header,
+                                 const std::uint64_t* offsets );
+
+      /// Get the offset of the payload from the start of the file
+      std::size_t binary_payload_offset( const binary_header& header );
+
+      /// Write a header, and the padding after the offsets (if any)
+      void write_binary_header( std::ostream& out,
+                                const binary_header& header,
+                                const std::uint64_t* offsets );
+
+      /// Read a header from an input stream
+      binary_header read_binary_header( std::istream& in );
+
+      /// Skip to the start of the payload, after reading the offsets
+      void skip_binary_padding( std::istream& in,
+                                const binary_header& header );
+
+      /// Read the header of a file, and skip to the start of its payload
+      ///
+      /// It accepts both 1-dimensional and jagged vectors, as the payloads of
+      /// both are stored in the same way.
+      ///
+      binary_header skip_to_binary_payload( std::istream& in,
+                                            std::size_t element_size );
+
+   } // namespace details
+
+} // namespace vecmem::io
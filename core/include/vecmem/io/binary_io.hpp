@@ -0,0 +1,74 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/io/binary_format.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <iosfwd>
+#include <type_traits>
+
+namespace vecmem::io {
+
+   /// @name Functions writing the vecmem binary format
+   /// @{
+
+   /// Write the contents of a 1-dimensional vector into a stream
+   template< typename TYPE >
+   void write_binary( std::ostream& out,
+                      const data::vector_view< TYPE >& data );
+
+   /// Write the contents of a jagged vector into a stream
+   ///
+   /// The views of the inner vectors, and their payload, must be host
+   /// accessible.
+   ///
+   template< typename TYPE >
+   void write_binary( std::ostream& out,
+                      const data::jagged_vector_view< TYPE >& data );
+
+   /// @}
+
+   /// @name Functions reading the vecmem binary format
+   /// @{
+
+   /// Read a 1-dimensional vector from a stream
+   ///
+   /// The payload is read with a single read operation, directly into the
+   /// memory allocated from @c resource, which must be host accessible.
+   ///
+   /// @throws std::runtime_error if the stream does not hold a 1-dimensional
+   ///         vector of the requested type
+   ///
+   template< typename TYPE >
+   data::vector_buffer< TYPE > read_binary_vector( std::istream& in,
+                                                   memory_resource& resource );
+
+   /// Read a jagged vector from a stream
+   ///
+   /// The payload is read with a single read operation, directly into the
+   /// memory allocated from @c resource, which must be host accessible.
+   ///
+   /// @throws std::runtime_error if the stream does not hold a jagged vector
+   ///         of the requested type
+   ///
+   template< typename TYPE >
+   data::jagged_vector_buffer< TYPE >
+   read_binary_jagged_vector( std::istream& in, memory_resource& resource );
+
+   /// @}
+
+} // namespace vecmem::io
+
+// Include the implementation.
+#include "vecmem/io/binary_io.ipp"
@@ -0,0 +1,137 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+namespace vecmem::io {
+
+   template< typename TYPE >
+   void write_binary( std::ostream& out,
+                      const data::vector_view< TYPE >& data ) {
+
+      // Make sure that the type can be written as it is.
+      static_assert( std::is_trivially_copyable< TYPE >::value,
+                     "Only trivially copyable types can be written" );
+
+      // Write the header.
+      const binary_header header =
+         details::make_binary_header( binary_content::vector, sizeof( TYPE ),
+                                      0, data.m_size );
+      details::write_binary_header( out, header, nullptr );
+
+      // Write the payload.
+      out.write( reinterpret_cast< const char* >( data.m_ptr ),
+                 data.m_size * sizeof( TYPE ) );
+      if( ! out ) {
+         throw std::runtime_error( "Failed to write vecmem binary payload" );
+      }
+   }
+
+   template< typename TYPE >
+   void write_binary( std::ostream& out,
+                      const data::jagged_vector_view< TYPE >& data ) {
+
+      // Make sure that the type can be written as it is.
+      static_assert( std::is_trivially_copyable< TYPE >::value,
+                     "Only trivially copyable types can be written" );
+
+      // Calculate the offsets of the inner vectors.
+      std::vector< std::uint64_t > offsets( data.m_size + 1, 0 );
+      for( std::size_t i = 0; i < data.m_size; ++i ) {
+         offsets[ i + 1 ] = offsets[ i ] + data.m_ptr[ i ].m_size;
+      }
+
+      // Write the header.
+      const binary_header header =
+         details::make_binary_header( binary_content::jagged_vector,
+                                      sizeof( TYPE ), data.m_size,
+                                      offsets.back() );
+      details::write_binary_header( out, header, offsets.data() );
+
+      // Write the payload.
+      for( std::size_t i = 0; i < data.m_size; ++i ) {
+         out.write( reinterpret_cast< const char* >( data.m_ptr[ i ].m_ptr ),
+                    data.m_ptr[ i ].m_size * sizeof( TYPE ) );
+      }
+      if( ! out ) {
+         throw std::runtime_error( "Failed to write vecmem binary payload" );
+      }
+   }
+
+   template< typename TYPE >
+   data::vector_buffer< TYPE > read_binary_vector( std::istream& in,
+                                                   memory_resource& resource ) {
+
+      // Make sure that the type can be read as it is.
+      static_assert( std::is_trivially_copyable< TYPE >::value,
+                     "Only trivially copyable types can be read" );
+
+      // Read the header.
+      const binary_header header = details::read_binary_header( in );
+      details::check_binary_header( header, binary_content::vector,
+                                    sizeof( TYPE ) );
+      details::skip_binary_padding( in, header );
+
+      // Read the payload.
+      data::vector_buffer< TYPE > result( header.m_elements, resource );
+      in.read( reinterpret_cast< char* >( result.m_ptr ),
+               header.m_elements * sizeof( TYPE ) );
+      if( ! in ) {
+         throw std::runtime_error( "Failed to read vecmem binary payload" );
+      }
+      return result;
+   }
+
+   template< typename TYPE >
+   data::jagged_vector_buffer< TYPE >
+   read_binary_jagged_vector( std::istream& in, memory_resource& resource ) {
+
+      // Make sure that the type can be read as it is.
+      static_assert( std::is_trivially_copyable< TYPE >::value,
+                     "Only trivially copyable types can be read" );
+
+      // Read the header, and the offsets.
+      const binary_header header = details::read_binary_header( in );
+      details::check_binary_header( header, binary_content::jagged_vector,
+                                    sizeof( TYPE ) );
+      std::vector< std::uint64_t > offsets( header.m_rows + 1 );
+      in.read( reinterpret_cast< char* >( offsets.data() ),
+               offsets.size() * sizeof( std::uint64_t ) );
+      if( ! in ) {
+         throw std::runtime_error( "Truncated vecmem binary file" );
+      }
+      details::check_binary_offsets( header, offsets.data() );
+      details::skip_binary_padding( in, header );
+
+      // Set up the result buffer.
+      data::jagged_vector_buffer< TYPE >
+         result( header.m_rows, header.m_elements, resource );
+      TYPE* payload = reinterpret_cast< TYPE* >(
+         static_cast< char* >( result.memory() ) +
+         result.layout().m_payload_offset );
+      for( std::size_t i = 0; i < header.m_rows; ++i ) {
+         new( result.m_ptr + i )
+            data::vector_view< TYPE >( offsets[ i + 1 ] - offsets[ i ],
+                                       payload + offsets[ i ] );
+      }
+
+      // Read the payload.
+      in.read( reinterpret_cast< char* >( payload ),
+               header.m_elements * sizeof( TYPE ) );
+      if( ! in ) {
+         throw std::runtime_error( "Failed to read vecmem binary payload" );
+      }
+      return result;
+   }
+
+} // namespace vecmem::io
@@ -0,0 +1,95 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/io/binary_format.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <fstream>
+#include <future>
+#include <string>
+
+namespace vecmem::io {
+
+   /// Streaming reader for the payload of large vecmem binary files
+   ///
+   /// The payload of a (1-dimensional or jagged) vector is delivered in
+   /// fixed size chunks. The chunks are read into one of two buffers allocated
+   /// from a user supplied memory resource, while the next chunk is read into
+   /// the other buffer on a background thread. So the memory used by the
+   /// reader does not depend on the size of the file, and reading the file
+   /// overlaps with the processing of its chunks.
+   ///
+   template< typename TYPE >
+   class chunked_reader {
+
+   public:
+      /// Constructor with the file to read, and the chunk size to use
+      ///
+      /// @param path The vecmem binary file to read
+      /// @param chunk_size The (maximal) number of elements in one chunk
+      /// @param resource The (host accessible) memory resource to allocate
+      ///                 the two chunk buffers from
+      ///
+      /// @throws std::runtime_error if the file could not be opened, or does
+      ///         not hold elements of the requested type
+      ///
+      chunked_reader( const std::string& path, std::size_t chunk_size,
+                      memory_resource& resource );
+      /// Destructor, waiting for the background read to finish
+      ~chunked_reader();
+
+      /// The object can not be copied
+      chunked_reader( const chunked_reader& ) = delete;
+      /// The object can not be copied
+      chunked_reader& operator=( const chunked_reader& ) = delete;
+
+      /// Get the total number of elements in the file
+      std::size_t size() const;
+      /// Get the (maximal) number of elements in one chunk
+      std::size_t chunk_size() const;
+
+      /// Get the next chunk of the file
+      ///
+      /// The returned view stays valid until the next call to this function.
+      /// An empty view is returned once the end of the file was reached.
+      ///
+      data::vector_view< const TYPE > next();
+
+   private:
+      /// Start reading the next chunk into one of the buffers
+      void prefetch( unsigned int buffer );
+
+      /// The stream reading the file
+      std::ifstream m_stream;
+      /// The total number of elements in the file
+      std::size_t m_elements;
+      /// The number of elements that were not yet scheduled for reading
+      std::size_t m_unread;
+      /// The (maximal) number of elements in one chunk
+      std::size_t m_chunk_size;
+      /// The two buffers that the chunks are read into
+      data::vector_buffer< TYPE > m_buffers[ 2 ];
+      /// The buffer that the next chunk is being read into
+      unsigned int m_next;
+      /// The number of elements read by the ongoing background read
+      std::future< std::size_t > m_pending;
+      /// The thread performing the reads in the background
+      thread_pool m_thread;
+
+   }; // class chunked_reader
+
+} // namespace vecmem::io
+
+// Include the implementation.
+#include "vecmem/io/chunked_reader.ipp"
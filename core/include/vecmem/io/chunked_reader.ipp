@@ -0,0 +1,116 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace vecmem::io {
+
+   template< typename TYPE >
+   chunked_reader< TYPE >::chunked_reader( const std::string& path,
+                                           std::size_t chunk_size,
+                                           memory_resource& resource )
+   : m_stream( path, std::ios::binary ), m_elements( 0 ), m_unread( 0 ),
+     m_chunk_size( std::max< std::size_t >( chunk_size, 1 ) ),
+     m_buffers{ { m_chunk_size, resource }, { m_chunk_size, resource } },
+     m_next( 0 ), m_pending(), m_thread( 1 ) {
+
+      // Make sure that the type can be read as it is.
+      static_assert( std::is_trivially_copyable< TYPE >::value,
+                     "Only trivially copyable types can be read" );
+
+      // Open the file, and position the stream at the start of the payload.
+      if( ! m_stream ) {
+         throw std::runtime_error( "Failed to open file: " + path );
+      }
+      const binary_header header =
+         details::skip_to_binary_payload( m_stream, sizeof( TYPE ) );
+      m_elements = header.m_elements;
+      m_unread = m_elements;
+
+      // Start reading the first chunk right away.
+      prefetch( m_next );
+   }
+
+   template< typename TYPE >
+   chunked_reader< TYPE >::~chunked_reader() {
+
+      // Let the ongoing read finish, before the buffers would be deleted.
+      if( m_pending.valid() ) {
+         m_pending.wait();
+      }
+   }
+
+   template< typename TYPE >
+   std::size_t chunked_reader< TYPE >::size() const {
+
+      return m_elements;
+   }
+
+   template< typename TYPE >
+   std::size_t chunked_reader< TYPE >::chunk_size() const {
+
+      return m_chunk_size;
+   }
+
+   template< typename TYPE >
+   data::vector_view< const TYPE > chunked_reader< TYPE >::next() {
+
+      // Once the end of the file was reached, there is nothing to wait for.
+      if( ! m_pending.valid() ) {
+         return { 0, nullptr };
+      }
+
+      // Wait for the ongoing read to finish. This re-throws any error that
+      // happened on the background thread.
+      const std::size_t count = m_pending.get();
+      if( count == 0 ) {
+         return { 0, nullptr };
+      }
+
+      // Start reading the following chunk into the other buffer, while this
+      // one is being processed.
+      const unsigned int filled = m_next;
+      m_next = 1 - m_next;
+      prefetch( m_next );
+
+      return { count, m_buffers[ filled ].m_ptr };
+   }
+
+   template< typename TYPE >
+   void chunked_reader< TYPE >::prefetch( unsigned int buffer ) {
+
+      // Decide how many elements to read.
+      const std::size_t count = std::min( m_chunk_size, m_unread );
+      m_unread -= count;
+
+      // Schedule the read on the background thread.
+      auto promise = std::make_shared< std::promise< std::size_t > >();
+      m_pending = promise->get_future();
+      char* target = reinterpret_cast< char* >( m_buffers[ buffer ].m_ptr );
+      m_thread.submit( [ this, promise, target, count ]() {
+         try {
+            if( count != 0 ) {
+               m_stream.read( target, count * sizeof( TYPE ) );
+               if( ! m_stream ) {
+                  throw std::runtime_error( "Failed to read vecmem binary "
+                                            "payload" );
+               }
+            }
+            promise->set_value( count );
+         } catch( ... ) {
+            promise->set_exception( std::current_exception() );
+         }
+      } );
+   }
+
+} // namespace vecmem::io
@@ -0,0 +1,84 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/io/binary_format.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <string>
+
+namespace vecmem::io {
+
+   /// Read-only, memory mapped vecmem binary file
+   ///
+   /// It provides views of the data in the file without copying the payload
+   /// anywhere. The views remain valid for as long as the object exists.
+   ///
+   class mapped_file {
+
+   public:
+      /// Constructor mapping the specified file into memory
+      ///
+      /// @throws std::runtime_error if the file could not be mapped, or if it
+      ///         does not hold a valid vecmem binary header
+      ///
+      mapped_file( const std::string& path );
+      /// Move constructor
+      mapped_file( mapped_file&& parent );
+      /// Destructor, unmapping the file
+      ~mapped_file();
+
+      /// The object can not be copied
+      mapped_file( const mapped_file& ) = delete;
+      /// The object can not be copied
+      mapped_file& operator=( const mapped_file& ) = delete;
+      /// Move assignment
+      mapped_file& operator=( mapped_file&& rhs );
+
+      /// Get the header of the file
+      const binary_header& header() const;
+      /// Get a pointer to the start of the mapped memory
+      const void* data() const;
+      /// Get the size of the mapped memory
+      std::size_t size() const;
+
+      /// Get a view of the 1-dimensional vector stored in the file
+      template< typename TYPE >
+      data::vector_view< const TYPE > view() const;
+
+      /// Get a view of the jagged vector stored in the file
+      ///
+      /// The views of the inner vectors are allocated from @c resource, and
+      /// point directly into the mapped memory.
+      ///
+      template< typename TYPE >
+      data::jagged_vector_buffer< const TYPE >
+      jagged_view( memory_resource& resource ) const;
+
+   private:
+      /// Get a pointer to the payload, after checking the header
+      const void* payload( binary_content content,
+                           std::size_t element_size ) const;
+      /// Get a pointer to the offsets of the inner vectors
+      const std::uint64_t* offsets() const;
+
+      /// Pointer to the mapped memory
+      void* m_data;
+      /// The size of the mapped memory
+      std::size_t m_size;
+
+   }; // class mapped_file
+
+} // namespace vecmem::io
+
+// Include the implementation.
+#include "vecmem/io/mapped_file.ipp"
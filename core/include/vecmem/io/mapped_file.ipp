@@ -0,0 +1,44 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <new>
+
+namespace vecmem::io {
+
+   template< typename TYPE >
+   data::vector_view< const TYPE > mapped_file::view() const {
+
+      return { header().m_elements,
+               static_cast< const TYPE* >(
+                  payload( binary_content::vector, sizeof( TYPE ) ) ) };
+   }
+
+   template< typename TYPE >
+   data::jagged_vector_buffer< const TYPE >
+   mapped_file::jagged_view( memory_resource& resource ) const {
+
+      // Access the payload and the offsets in the file.
+      const TYPE* data = static_cast< const TYPE* >(
+         payload( binary_content::jagged_vector, sizeof( TYPE ) ) );
+      const std::uint64_t* offs = offsets();
+      details::check_binary_offsets( header(), offs );
+
+      // Set up views pointing into the mapped memory. Allocating space just
+      // for the views, not for the payload.
+      const std::size_t rows = header().m_rows;
+      data::jagged_vector_buffer< const TYPE > result( rows, 0, resource );
+      for( std::size_t i = 0; i < rows; ++i ) {
+         new( result.m_ptr + i )
+            data::vector_view< const TYPE >( offs[ i + 1 ] - offs[ i ],
+                                             data + offs[ i ] );
+      }
+      return result;
+   }
+
+} // namespace vecmem::io
@@ -39,6 +39,18 @@ namespace vecmem {
          * allocated blocks upstream.
          */
         ~binary_page_memory_resource();
+
+        /**
+         * @brief Give the completely unused root pages back to the upstream
+         * memory resource.
+         *
+         * This can be used to reduce the memory use of the resource after a
+         * peak in its usage, for instance from a memory pressure callback of
+         * @c vecmem::limited_memory_resource.
+         *
+         * @return The number of bytes given back to the upstream resource.
+         */
+        std::size_t trim();
     private:
         /**
          * @brief The different possible states a page can be in.
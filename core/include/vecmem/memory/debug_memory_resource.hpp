@@ -0,0 +1,118 @@
+/**
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#include "vecmem/memory/memory_resource.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace vecmem {
+    /**
+     * @brief Downstream memory resource catching buffer overruns early.
+     *
+     * This resource wraps an upstream resource, and adds cheap checks to the
+     * memory blocks handed out by it, so that writes past the end of a
+     * buffer would be noticed close to where they happen.
+     *
+     * - Large allocations (of at least @c guard_threshold bytes) are placed
+     *   right in front of a page that is made inaccessible with @c mprotect.
+     *   Writing past the end of such a block results in an immediate
+     *   segmentation fault.
+     * - Small allocations are surrounded by "canary" bytes with a known
+     *   pattern, which are checked when the block is deallocated.
+     * - Freed memory is filled with a pattern (@c freed_pattern) before
+     *   being given back to the upstream resource, to make the use of freed
+     *   memory easier to notice.
+     *
+     * The checks cost a few extra bytes for every small allocation, two
+     * system calls and about two pages for every large one, plus filling
+     * the freed memory. Which is cheap enough for production-size workloads.
+     *
+     * @note The upstream resource needs to provide host accessible memory,
+     * and needs to respect the requested alignment of the small allocations.
+     * For the guard pages to work, its memory also needs to be something
+     * that @c mprotect can act on. If @c mprotect fails, large allocations
+     * are handed out without a guard page.
+     */
+    class debug_memory_resource : public memory_resource {
+    public:
+        /**
+         * @brief The default minimum size of allocations with guard pages.
+         */
+        static constexpr std::size_t default_guard_threshold = 65536;
+
+        /**
+         * @brief The number of canary bytes on each side of small blocks.
+         */
+        static constexpr std::size_t canary_size = 16;
+
+        /**
+         * @brief The pattern written into the canary bytes.
+         */
+        static constexpr unsigned char canary_pattern = 0xCA;
+
+        /**
+         * @brief The pattern written into freed memory.
+         */
+        static constexpr unsigned char freed_pattern = 0xDD;
+
+        /**
+         * @brief Constructs the debug memory resource.
+         *
+         * @param[in] upstream The upstream memory resource to use.
+         * @param[in] guard_threshold The minimum size of the allocations that
+         * get a guard page. Zero turns the guard pages off.
+         * @param[in] abort_on_corruption Whether to abort the application
+         * when corrupted canary bytes are found, or just to count the
+         * corruptions.
+         */
+        debug_memory_resource(
+            memory_resource & upstream,
+            std::size_t guard_threshold = default_guard_threshold,
+            bool abort_on_corruption = true
+        );
+
+        /**
+         * @brief The number of corrupted blocks found so far.
+         */
+        std::size_t corruptions() const;
+
+    private:
+        virtual void * do_allocate(
+            std::size_t,
+            std::size_t
+        ) override;
+
+        virtual void do_deallocate(
+            void * p,
+            std::size_t,
+            std::size_t
+        ) override;
+
+        virtual bool do_is_equal(
+            const memory_resource &
+        ) const noexcept override;
+
+        /**
+         * @brief Check whether an allocation gets a guard page.
+         */
+        bool guarded(std::size_t size) const;
+
+        /**
+         * @brief Report a corrupted memory block.
+         */
+        void report(const void * p, std::size_t size);
+
+        memory_resource & m_upstream;
+        const std::size_t m_guard_threshold;
+        const bool m_abort_on_corruption;
+        std::atomic<std::size_t> m_corruptions;
+    };
+}
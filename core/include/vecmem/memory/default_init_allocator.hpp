@@ -0,0 +1,90 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace vecmem {
+
+   /// Allocator adaptor default-initialising (instead of value-initialising)
+   /// the elements constructed without arguments
+   ///
+   /// Containers like @c std::vector value-initialise the elements that they
+   /// create in @c resize(...) or in their size-taking constructor. For
+   /// trivial types this means zero-filling the memory, which is a waste of
+   /// time for buffers that would be overwritten right away. This adaptor
+   /// default-initialises trivially default constructible elements instead,
+   /// leaving them uninitialised. Construction with arguments is forwarded
+   /// unchanged to the underlying allocator.
+   ///
+   template< typename ALLOC >
+   class default_init_allocator : public ALLOC {
+
+   private:
+      /// Traits of the underlying allocator
+      typedef std::allocator_traits< ALLOC > traits_type;
+
+   public:
+      /// Rebind the allocator to a different type
+      template< typename U >
+      struct rebind {
+         /// The rebound allocator type
+         typedef default_init_allocator<
+            typename traits_type::template rebind_alloc< U > > other;
+      };
+
+      /// Inherit all constructors from the underlying allocator
+      using ALLOC::ALLOC;
+
+      /// Default constructor
+      default_init_allocator() = default;
+      /// Construct the adaptor from the underlying allocator
+      default_init_allocator( const ALLOC& parent ) noexcept
+      : ALLOC( parent ) {}
+      /// Construct the adaptor from an adaptor of a different type
+      template< typename OTHER >
+      default_init_allocator( const default_init_allocator< OTHER >& parent )
+         noexcept
+      : ALLOC( static_cast< const OTHER& >( parent ) ) {}
+
+      /// Default-initialise an object
+      ///
+      /// Only trivially default constructible types are default-initialised
+      /// directly. All other types are constructed by the underlying
+      /// allocator, so that uses-allocator construction would still happen.
+      ///
+      template< typename U >
+      void construct( U* ptr ) {
+
+         if constexpr( std::is_trivially_default_constructible< U >::value ) {
+            ::new( static_cast< void* >( ptr ) ) U;
+         } else {
+            traits_type::construct( static_cast< ALLOC& >( *this ), ptr );
+         }
+      }
+      /// Construct an object with the underlying allocator
+      template< typename U, typename... Args >
+      void construct( U* ptr, Args&&... args ) {
+
+         traits_type::construct( static_cast< ALLOC& >( *this ), ptr,
+                                 std::forward< Args >( args )... );
+      }
+
+      /// Allocator to use in copies of a container
+      default_init_allocator select_on_container_copy_construction() const {
+
+         return traits_type::select_on_container_copy_construction(
+            static_cast< const ALLOC& >( *this ) );
+      }
+
+   }; // class default_init_allocator
+
+} // namespace vecmem
@@ -18,10 +18,36 @@ namespace vecmem {
      * @brief Memory resource which wraps the malloc standard library call.
      *
      * This is probably the simplest memory resource you can possibly write. It
-     * is a terminal resource which does nothing but wrap malloc and free. It
-     * is state-free (on the relevant levels of abstraction).
+     * is a terminal resource which wraps malloc and free. It is state-free
+     * (on the relevant levels of abstraction).
+     *
+     * Small allocations (up to 1 kiB) are by default served from a
+     * thread-local cache of recently freed blocks, organised into "magazines"
+     * of a few dozen blocks per size class. This makes short lived containers
+     * very cheap to create and destroy. Blocks freed on a different thread
+     * than the one that allocated them end up in the cache of the freeing
+     * thread, and all cached blocks are released when their thread exits.
+     *
+     * Building the library with @c VECMEM_HOST_CACHE_INITIAL_EXEC_TLS makes
+     * the cache a bit faster, but then the library can not be loaded with
+     * @c dlopen (directly, or through a plugin) anymore.
      */
     class host_memory_resource : public vecmem::memory_resource {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param[in] use_cache Whether small allocations should go through the
+         * thread-local cache, or straight to malloc and free.
+         */
+        host_memory_resource(bool use_cache = true);
+
+        /**
+         * @brief Check whether small allocations go through the thread-local
+         * cache.
+         */
+        bool uses_cache() const;
+
     private:
         virtual void * do_allocate(
             std::size_t,
@@ -37,5 +63,10 @@ namespace vecmem {
         virtual bool do_is_equal(
             const memory_resource &
         ) const noexcept override;
+
+        /**
+         * @brief Whether small allocations go through the thread-local cache.
+         */
+        bool m_use_cache;
     };
 }
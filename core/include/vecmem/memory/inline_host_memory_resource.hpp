@@ -0,0 +1,79 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace vecmem {
+
+   /// Host memory resource with inline, non-virtual allocation functions
+   ///
+   /// The resource allocates its memory with @c std::malloc (or with
+   /// @c std::aligned_alloc for over-aligned requests). Its own @c allocate
+   /// and @c deallocate functions hide the ones of
+   /// @c vecmem::memory_resource, so that when they are called on the
+   /// concrete type, like @c vecmem::static_allocator does, no virtual
+   /// function call is made, and the allocation can be inlined. When used
+   /// through a @c vecmem::memory_resource reference, the resource behaves
+   /// like any other one.
+   ///
+   class inline_host_memory_resource final : public memory_resource {
+
+   public:
+      /// Allocate a memory block, without a virtual function call
+      void* allocate( std::size_t bytes,
+                      std::size_t alignment = alignof( std::max_align_t ) ) {
+
+         void* result = nullptr;
+         if( alignment <= alignof( std::max_align_t ) ) {
+            result = std::malloc( bytes );
+         } else {
+            result = std::aligned_alloc(
+               alignment, ( ( bytes + alignment - 1 ) / alignment ) *
+                          alignment );
+         }
+         if( ( result == nullptr ) && ( bytes != 0 ) ) {
+            throw std::bad_alloc();
+         }
+         return result;
+      }
+      /// Deallocate a memory block, without a virtual function call
+      void deallocate( void* p, std::size_t,
+                       std::size_t = alignof( std::max_align_t ) ) {
+
+         std::free( p );
+      }
+
+   private:
+      /// Allocate a memory block through the virtual interface
+      void* do_allocate( std::size_t bytes, std::size_t alignment ) override {
+
+         return allocate( bytes, alignment );
+      }
+      /// Deallocate a memory block through the virtual interface
+      void do_deallocate( void* p, std::size_t bytes,
+                          std::size_t alignment ) override {
+
+         deallocate( p, bytes, alignment );
+      }
+      /// All instances of this resource are equal
+      bool do_is_equal( const memory_resource& other ) const
+         noexcept override {
+
+         return ( dynamic_cast< const inline_host_memory_resource* >(
+                     &other ) != nullptr );
+      }
+
+   }; // class inline_host_memory_resource
+
+} // namespace vecmem
@@ -0,0 +1,121 @@
+/**
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#include "vecmem/memory/memory_resource.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace vecmem {
+    /**
+     * @brief Downstream memory resource enforcing a memory budget.
+     *
+     * This resource keeps track of the number of bytes allocated through it
+     * from its upstream resource, and refuses to go over a hard limit by
+     * throwing @c std::bad_alloc. Before that happens, it notifies the
+     * registered "memory pressure" callbacks, so that they could release
+     * memory that they don't really need. For instance by trimming caches,
+     * or by calling @c vecmem::binary_page_memory_resource::trim on pool
+     * resources that use this resource as their upstream.
+     *
+     * The callbacks are invoked whenever an allocation makes the memory use
+     * cross the soft limit, and once more before an allocation is refused
+     * for going over the hard limit. The accounting itself only uses
+     * atomic operations, so it is cheap enough to be done on every
+     * allocation.
+     *
+     * @note The callbacks are called from within the allocation requests,
+     * from whichever thread made them. They may deallocate memory through
+     * this resource, but should not allocate through it.
+     */
+    class limited_memory_resource : public memory_resource {
+    public:
+        /**
+         * @brief The type of the memory pressure callbacks.
+         */
+        typedef std::function<void()> callback_type;
+
+        /**
+         * @brief Constructs the limited memory resource.
+         *
+         * @param[in] upstream The upstream memory resource to use.
+         * @param[in] hard_limit The maximum number of bytes that can be
+         * allocated through the resource at the same time.
+         * @param[in] soft_limit The number of bytes above which the memory
+         * pressure callbacks are called. Zero means the same as the hard
+         * limit.
+         */
+        limited_memory_resource(
+            memory_resource & upstream,
+            std::size_t hard_limit,
+            std::size_t soft_limit = 0
+        );
+
+        /**
+         * @brief Register a memory pressure callback.
+         */
+        void add_callback(callback_type callback);
+
+        /**
+         * @brief The number of bytes currently allocated.
+         */
+        std::size_t used() const;
+
+        /**
+         * @brief The hard limit of the resource.
+         */
+        std::size_t hard_limit() const;
+
+        /**
+         * @brief The soft limit of the resource.
+         */
+        std::size_t soft_limit() const;
+
+    private:
+        virtual void * do_allocate(
+            std::size_t,
+            std::size_t
+        ) override;
+
+        virtual void do_deallocate(
+            void * p,
+            std::size_t,
+            std::size_t
+        ) override;
+
+        virtual bool do_is_equal(
+            const memory_resource &
+        ) const noexcept override;
+
+        /**
+         * @brief Try to account for an allocation within the hard limit.
+         *
+         * @param[in] size The size of the allocation.
+         * @param[out] before The memory use before the allocation.
+         * @return Whether the allocation fits within the hard limit.
+         */
+        bool reserve(std::size_t size, std::size_t & before);
+
+        /**
+         * @brief Call all of the memory pressure callbacks.
+         */
+        void notify();
+
+        memory_resource & m_upstream;
+        const std::size_t m_hard_limit;
+        const std::size_t m_soft_limit;
+        std::atomic<std::size_t> m_used;
+        std::mutex m_callbacks_mutex;
+        std::vector<callback_type> m_callbacks;
+    };
+}
@@ -0,0 +1,94 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/copy_decision.hpp"
+
+// System include(s).
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vecmem {
+
+   /// Thread-safe registry of memory resources, per device and memory kind
+   ///
+   /// The registry creates one memory resource for every (device, memory
+   /// kind) pair on first use, through a factory set up for the memory kind
+   /// beforehand, and hands out that same resource to every thread asking
+   /// for it afterwards. This way the (pooling) resources of an application
+   /// can be shared without passing them around explicitly.
+   ///
+   /// Looking up a resource that was already created is lock-free. The
+   /// factories are called without holding any lock, so that they could take
+   /// their upstream resources from the registry as well. If multiple threads
+   /// ask for a missing resource at the same time, the factory may be called
+   /// more than once, with only the first resource finished being kept.
+   ///
+   /// @note The resources themselves need to be thread-safe, if they are
+   ///       used from multiple threads.
+   ///
+   class resource_registry {
+
+   public:
+      /// The maximum number of devices handled by the registry
+      static constexpr int max_devices = 32;
+
+      /// Type of the functions creating the memory resources
+      typedef std::function< std::unique_ptr< memory_resource >( int ) >
+         factory_type;
+
+      /// Default constructor
+      resource_registry();
+      /// Destructor
+      ~resource_registry();
+
+      /// Access a global instance of the registry
+      static resource_registry& instance();
+
+      /// Set the factory creating the resources of a given memory kind
+      ///
+      /// The factory is called with the device identifier, and needs to
+      /// return a resource that remains valid on its own. It may call
+      /// @c get(...) for other memory kinds, to build on top of their
+      /// resources. It only affects the resources that were not created yet.
+      ///
+      void set_factory( memory_kind::kind_type kind, factory_type factory );
+
+      /// Get the memory resource for a given device and memory kind
+      ///
+      /// @throws std::out_of_range If the device identifier is out of range
+      /// @throws std::runtime_error If no factory was set for the memory kind
+      ///
+      memory_resource& get( int device, memory_kind::kind_type kind );
+
+   private:
+      /// The number of memory kinds handled by the registry
+      static constexpr std::size_t n_kinds = memory_kind::unknown + 1;
+
+      /// Create the resource for a given device and memory kind
+      memory_resource& create( int device, memory_kind::kind_type kind );
+
+      /// The resources handed out, one per device and memory kind
+      std::array< std::atomic< memory_resource* >, max_devices * n_kinds >
+         m_resources;
+      /// Mutex guarding the factories and the publishing of the resources
+      std::mutex m_mutex;
+      /// The factories of the different memory kinds
+      std::array< factory_type, n_kinds > m_factories;
+      /// The resources owned by the registry
+      std::vector< std::unique_ptr< memory_resource > > m_owned;
+
+   }; // class resource_registry
+
+} // namespace vecmem
@@ -0,0 +1,124 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <type_traits>
+
+namespace vecmem {
+
+   namespace details {
+
+      /// Get a (default constructed) instance of a memory resource type
+      template< typename RESOURCE >
+      RESOURCE& static_resource_instance() {
+
+         static RESOURCE instance;
+         return instance;
+      }
+
+   } // namespace details
+
+   /// Allocator using a memory resource of a type known at compile time
+   ///
+   /// Unlike @c vecmem::polymorphic_allocator, this allocator calls the
+   /// @c allocate and @c deallocate functions of a concrete resource type
+   /// directly. If those are non-virtual, inline functions (like the ones of
+   /// @c vecmem::inline_host_memory_resource), the compiler can inline the
+   /// entire allocation into the code of the container using the allocator.
+   /// Any @c vecmem::memory_resource type can be used with it as well, in
+   /// which case the calls still go through the virtual interface of the
+   /// resource.
+   ///
+   /// The resource type needs to provide:
+   ///   - <tt>void* allocate( std::size_t bytes, std::size_t alignment )</tt>
+   ///   - <tt>void deallocate( void* p, std::size_t bytes,
+   ///                          std::size_t alignment )</tt>
+   ///
+   /// Containers using this allocator can be used with @c vecmem::get_data,
+   /// like the containers using the polymorphic allocator.
+   ///
+   template< typename T, typename RESOURCE >
+   class static_allocator {
+
+   public:
+      /// The type of the allocated objects
+      typedef T value_type;
+      /// The type of the memory resource used
+      typedef RESOURCE resource_type;
+
+      /// The memory resource is carried along by the containers
+      typedef std::true_type propagate_on_container_copy_assignment;
+      /// The memory resource is carried along by the containers
+      typedef std::true_type propagate_on_container_move_assignment;
+      /// The memory resource is carried along by the containers
+      typedef std::true_type propagate_on_container_swap;
+
+      /// Rebind the allocator to a different type
+      template< typename U >
+      struct rebind {
+         /// The rebound allocator type
+         typedef static_allocator< U, RESOURCE > other;
+      };
+
+      /// Default constructor, using a global instance of the resource type
+      template< typename R = RESOURCE,
+                typename = std::enable_if_t<
+                   std::is_default_constructible< R >::value > >
+      static_allocator() noexcept
+      : m_resource( &( details::static_resource_instance< RESOURCE >() ) ) {}
+      /// Constructor with a specific memory resource
+      static_allocator( RESOURCE& resource ) noexcept
+      : m_resource( &resource ) {}
+      /// Constructor from an allocator of a different value type
+      template< typename U >
+      static_allocator( const static_allocator< U, RESOURCE >& parent )
+         noexcept
+      : m_resource( &( parent.resource() ) ) {}
+
+      /// Allocate memory for a number of objects
+      T* allocate( std::size_t n ) {
+
+         return static_cast< T* >(
+            m_resource->allocate( n * sizeof( T ), alignof( T ) ) );
+      }
+      /// Deallocate the memory of a number of objects
+      void deallocate( T* p, std::size_t n ) {
+
+         m_resource->deallocate( p, n * sizeof( T ), alignof( T ) );
+      }
+
+      /// Get the memory resource used by the allocator
+      RESOURCE& resource() const noexcept {
+
+         return *m_resource;
+      }
+
+   private:
+      /// The memory resource used by the allocator
+      RESOURCE* m_resource;
+
+   }; // class static_allocator
+
+   /// Equality operator for @c vecmem::static_allocator
+   template< typename T1, typename T2, typename RESOURCE >
+   bool operator==( const static_allocator< T1, RESOURCE >& a1,
+                    const static_allocator< T2, RESOURCE >& a2 ) noexcept {
+
+      return ( &( a1.resource() ) == &( a2.resource() ) );
+   }
+
+   /// Inequality operator for @c vecmem::static_allocator
+   template< typename T1, typename T2, typename RESOURCE >
+   bool operator!=( const static_allocator< T1, RESOURCE >& a1,
+                    const static_allocator< T2, RESOURCE >& a2 ) noexcept {
+
+      return !( a1 == a2 );
+   }
+
+} // namespace vecmem
@@ -0,0 +1,31 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem {
+
+   /// Interface for the events returned by asynchronous operations
+   ///
+   /// Every backend (host thread pool, CUDA stream, SYCL queue, etc.) provides
+   /// its own implementation of this interface, which allows client code to
+   /// synchronise with operations that were submitted earlier, without having
+   /// to know anything about the backend that executes them.
+   ///
+   class abstract_event {
+
+   public:
+      /// Virtual destructor, to make vtable happy
+      virtual ~abstract_event() = default;
+
+      /// Block the calling thread until the operation(s) finished
+      virtual void wait() = 0;
+      /// Check, without blocking, whether the operation(s) finished
+      virtual bool ready() const = 0;
+
+   }; // class abstract_event
+
+} // namespace vecmem
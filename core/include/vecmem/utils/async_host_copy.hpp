@@ -0,0 +1,63 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+
+namespace vecmem {
+
+   /// Host backend for @c vecmem::copy, using a pool of threads
+   ///
+   /// Copies are executed in the background by the threads of a
+   /// @c vecmem::thread_pool. Large copies are split into chunks, which are
+   /// executed in parallel by the threads of the pool.
+   ///
+   /// @note The class can only be used with host accessible memory.
+   ///
+   class async_host_copy : public copy {
+
+   public:
+      /// The default size of the chunks that copies are split into
+      static constexpr std::size_t default_chunk_size = 1048576;
+
+      /// Constructor with a chunk size, launching a private thread pool
+      async_host_copy( std::size_t chunk_size = default_chunk_size );
+      /// Constructor with an existing thread pool, and a chunk size
+      async_host_copy( thread_pool& pool,
+                       std::size_t chunk_size = default_chunk_size );
+      /// Destructor
+      ~async_host_copy();
+
+      /// Get the size of the chunks that copies are split into
+      std::size_t chunk_size() const;
+
+   protected:
+      /// Perform a memory copy, synchronously
+      virtual void do_copy( std::size_t size, const void* from, void* to,
+                            type::copy_type cptype ) override;
+      /// Perform a memory copy, asynchronously
+      virtual event_type do_copy_async( std::size_t size, const void* from,
+                                        void* to,
+                                        type::copy_type cptype ) override;
+
+   private:
+      /// Thread pool owned by this object (if any)
+      std::unique_ptr< thread_pool > m_own_pool;
+      /// The thread pool used for the copies
+      thread_pool& m_pool;
+      /// The size of the chunks that copies are split into
+      std::size_t m_chunk_size;
+
+   }; // class async_host_copy
+
+} // namespace vecmem
@@ -0,0 +1,72 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/types.hpp"
+
+/// Atomic operations usable in host and device code
+///
+/// These functions operate on plain (non-@c std::atomic) variables, so that
+/// they could be used on memory shared between the host and the devices. In
+/// CUDA and HIP device code they use the intrinsic atomic functions, in host
+/// code they use the GCC/Clang atomic builtins. They can only be used with
+/// 4 and 8 byte integral types.
+///
+namespace vecmem::details {
+
+   /// Atomically compare the value of a variable, and replace it on a match
+   ///
+   /// @return The value of the variable before the operation. The exchange
+   ///         succeeded if this is equal to @c expected.
+   ///
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_compare_exchange( T* address, T expected, T desired );
+
+   /// Atomically load the value of a variable
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_load( const T* address );
+
+   /// Atomically store a value in a variable
+   ///
+   /// All memory writes made by the calling thread before this operation
+   /// become visible to the threads loading the new value.
+   ///
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   void atomic_store( T* address, T value );
+
+   /// Atomically add a value to a variable
+   ///
+   /// @return The value of the variable before the addition
+   ///
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_add( T* address, T value );
+
+   /// Atomically perform a bitwise "or" on a variable
+   ///
+   /// @return The value of the variable before the operation
+   ///
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_or( T* address, T value );
+
+   /// Atomically perform a bitwise "and" on a variable
+   ///
+   /// @return The value of the variable before the operation
+   ///
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_and( T* address, T value );
+
+} // namespace vecmem::details
+
+// Include the implementation.
+#include "vecmem/utils/atomic.ipp"
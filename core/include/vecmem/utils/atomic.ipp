@@ -0,0 +1,131 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <type_traits>
+
+// Flag for device code with CUDA/HIP atomic intrinsics.
+#if ( defined(__CUDACC__) && defined(__CUDA_ARCH__) ) || \
+    ( defined(__HIP__) && defined(__HIP_DEVICE_COMPILE__) )
+#   define VECMEM_DEVICE_ATOMICS
+#endif
+
+namespace vecmem::details {
+
+   /// Integer type that the device intrinsics use for a given type
+   template< typename T >
+   using atomic_storage_t =
+      std::conditional_t< sizeof( T ) == 4, unsigned int,
+                          unsigned long long >;
+
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_compare_exchange( T* address, T expected, T desired ) {
+
+      static_assert( std::is_integral< T >::value &&
+                     ( ( sizeof( T ) == 4 ) || ( sizeof( T ) == 8 ) ),
+                     "Only 4 and 8 byte integral types are supported" );
+#ifdef VECMEM_DEVICE_ATOMICS
+      typedef atomic_storage_t< T > storage_t;
+      return static_cast< T >(
+         atomicCAS( reinterpret_cast< storage_t* >( address ),
+                    static_cast< storage_t >( expected ),
+                    static_cast< storage_t >( desired ) ) );
+#else
+      __atomic_compare_exchange_n( address, &expected, desired, false,
+                                   __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE );
+      return expected;
+#endif // VECMEM_DEVICE_ATOMICS
+   }
+
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_load( const T* address ) {
+
+      static_assert( std::is_integral< T >::value &&
+                     ( ( sizeof( T ) == 4 ) || ( sizeof( T ) == 8 ) ),
+                     "Only 4 and 8 byte integral types are supported" );
+#ifdef VECMEM_DEVICE_ATOMICS
+      const T result = *( reinterpret_cast< const volatile T* >( address ) );
+      __threadfence();
+      return result;
+#else
+      return __atomic_load_n( address, __ATOMIC_ACQUIRE );
+#endif // VECMEM_DEVICE_ATOMICS
+   }
+
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   void atomic_store( T* address, T value ) {
+
+      static_assert( std::is_integral< T >::value &&
+                     ( ( sizeof( T ) == 4 ) || ( sizeof( T ) == 8 ) ),
+                     "Only 4 and 8 byte integral types are supported" );
+#ifdef VECMEM_DEVICE_ATOMICS
+      __threadfence();
+      *( reinterpret_cast< volatile T* >( address ) ) = value;
+#else
+      __atomic_store_n( address, value, __ATOMIC_RELEASE );
+#endif // VECMEM_DEVICE_ATOMICS
+   }
+
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_add( T* address, T value ) {
+
+      static_assert( std::is_integral< T >::value &&
+                     ( ( sizeof( T ) == 4 ) || ( sizeof( T ) == 8 ) ),
+                     "Only 4 and 8 byte integral types are supported" );
+#ifdef VECMEM_DEVICE_ATOMICS
+      typedef atomic_storage_t< T > storage_t;
+      return static_cast< T >(
+         atomicAdd( reinterpret_cast< storage_t* >( address ),
+                    static_cast< storage_t >( value ) ) );
+#else
+      return __atomic_fetch_add( address, value, __ATOMIC_ACQ_REL );
+#endif // VECMEM_DEVICE_ATOMICS
+   }
+
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_or( T* address, T value ) {
+
+      static_assert( std::is_integral< T >::value &&
+                     ( ( sizeof( T ) == 4 ) || ( sizeof( T ) == 8 ) ),
+                     "Only 4 and 8 byte integral types are supported" );
+#ifdef VECMEM_DEVICE_ATOMICS
+      typedef atomic_storage_t< T > storage_t;
+      return static_cast< T >(
+         atomicOr( reinterpret_cast< storage_t* >( address ),
+                   static_cast< storage_t >( value ) ) );
+#else
+      return __atomic_fetch_or( address, value, __ATOMIC_ACQ_REL );
+#endif // VECMEM_DEVICE_ATOMICS
+   }
+
+   template< typename T >
+   VECMEM_HOST_AND_DEVICE
+   T atomic_and( T* address, T value ) {
+
+      static_assert( std::is_integral< T >::value &&
+                     ( ( sizeof( T ) == 4 ) || ( sizeof( T ) == 8 ) ),
+                     "Only 4 and 8 byte integral types are supported" );
+#ifdef VECMEM_DEVICE_ATOMICS
+      typedef atomic_storage_t< T > storage_t;
+      return static_cast< T >(
+         atomicAnd( reinterpret_cast< storage_t* >( address ),
+                    static_cast< storage_t >( value ) ) );
+#else
+      return __atomic_fetch_and( address, value, __ATOMIC_ACQ_REL );
+#endif // VECMEM_DEVICE_ATOMICS
+   }
+
+} // namespace vecmem::details
+
+// Clean up.
+#undef VECMEM_DEVICE_ATOMICS
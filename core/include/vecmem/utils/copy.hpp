@@ -0,0 +1,162 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/abstract_event.hpp"
+#include "vecmem/utils/copy_batch.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace vecmem {
+
+   /// Backend independent interface for performing memory copies
+   ///
+   /// The public, templated functions of the class describe the copy
+   /// operations in terms of the data types of the library. The actual memory
+   /// transfers are implemented by the backend specific classes, through the
+   /// protected virtual functions of the class.
+   ///
+   /// The base class itself implements all copies with @c std::memcpy, so it
+   /// can be used directly for copies between host accessible memory blocks.
+   ///
+   class copy {
+
+   public:
+      /// Types of memory copies to perform
+      struct type {
+         /// Enumeration of the different copy directions
+         enum copy_type {
+            /// Copy from host memory to device memory
+            host_to_device = 0,
+            /// Copy from device memory to host memory
+            device_to_host = 1,
+            /// Copy from host memory to host memory
+            host_to_host = 2,
+            /// Copy from device memory to device memory
+            device_to_device = 3,
+            /// Unknown copy direction, to be figured out by the backend
+            unknown = 4
+         }; // enum copy_type
+      }; // struct type
+
+      /// Type of the events returned by the asynchronous functions
+      typedef std::unique_ptr< abstract_event > event_type;
+
+      /// Virtual destructor
+      virtual ~copy();
+
+      /// @name 1-dimensional vector data handling functions
+      /// @{
+
+      /// Copy the contents of a 1-dimensional array, synchronously
+      template< typename TYPE1, typename TYPE2 >
+      void operator()( const data::vector_view< TYPE1 >& from,
+                       const data::vector_view< TYPE2 >& to,
+                       type::copy_type cptype = type::unknown );
+
+      /// Copy a 1-dimensional array into a new buffer, synchronously
+      template< typename TYPE >
+      data::vector_buffer< std::remove_cv_t< TYPE > >
+      to( const data::vector_view< TYPE >& from, memory_resource& resource,
+          type::copy_type cptype = type::unknown );
+
+      /// Copy the contents of a 1-dimensional array, asynchronously
+      ///
+      /// The memory blocks described by the views must remain valid until the
+      /// returned event reports that the copy has finished.
+      ///
+      template< typename TYPE1, typename TYPE2 >
+      event_type async( const data::vector_view< TYPE1 >& from,
+                        const data::vector_view< TYPE2 >& to,
+                        type::copy_type cptype = type::unknown );
+
+      /// @}
+
+      /// @name Jagged vector data handling functions
+      /// @{
+
+      /// Copy a jagged vector into a new buffer, with a single memory transfer
+      ///
+      /// The inner vectors are gathered into a single, contiguous memory block
+      /// on the host, together with the views describing them. Which is then
+      /// copied into the target memory resource in one go. For host-to-host
+      /// copies the data is gathered directly into the target memory block.
+      ///
+      /// @note The views and the payload of @c from must be host accessible.
+      ///
+      template< typename TYPE >
+      data::jagged_vector_buffer< std::remove_cv_t< TYPE > >
+      to( const data::jagged_vector_view< TYPE >& from,
+          memory_resource& resource, type::copy_type cptype = type::unknown );
+
+      /// @}
+
+      /// @name Batched copy functions
+      /// @{
+
+      /// Perform all copies of a batch, synchronously
+      ///
+      /// The small copies of the batch are gathered into a memory block
+      /// allocated from @c from_scratch, which is copied in one go into a
+      /// memory block allocated from @c to_scratch, from where the data is
+      /// scattered into the target memory blocks. The large copies are
+      /// performed one by one. Host-to-host copies are all performed
+      /// directly, as packing would only add to their cost.
+      ///
+      /// @param batch The copies to perform
+      /// @param from_scratch Resource for memory like that of the sources
+      /// @param to_scratch Resource for memory like that of the targets
+      /// @param cptype The direction of all of the copies
+      ///
+      void operator()( const copy_batch& batch, memory_resource& from_scratch,
+                       memory_resource& to_scratch,
+                       type::copy_type cptype = type::unknown );
+
+      /// @}
+
+   protected:
+      /// Perform a "low level" memory copy, synchronously
+      virtual void do_copy( std::size_t size, const void* from, void* to,
+                            type::copy_type cptype );
+      /// Perform a "low level" memory copy, asynchronously
+      ///
+      /// The default implementation performs the copy synchronously using
+      /// @c do_copy, and returns an event that is already in a ready state.
+      ///
+      virtual event_type do_copy_async( std::size_t size, const void* from,
+                                        void* to, type::copy_type cptype );
+
+      /// Gather the packed copies of a batch into a single memory block
+      ///
+      /// Both the sources of the copies and @c packed are in the source
+      /// memory of the copy. The default implementation uses @c std::memcpy.
+      ///
+      virtual void do_gather( const copy_batch& batch, void* packed,
+                              type::copy_type cptype );
+      /// Scatter the packed copies of a batch from a single memory block
+      ///
+      /// Both @c packed and the targets of the copies are in the target
+      /// memory of the copy. The default implementation uses @c std::memcpy.
+      ///
+      virtual void do_scatter( const copy_batch& batch, const void* packed,
+                               type::copy_type cptype );
+
+   }; // class copy
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/copy.ipp"
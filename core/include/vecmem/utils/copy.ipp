@@ -0,0 +1,87 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cassert>
+#include <memory>
+
+namespace vecmem {
+
+   template< typename TYPE1, typename TYPE2 >
+   void copy::operator()( const data::vector_view< TYPE1 >& from,
+                          const data::vector_view< TYPE2 >& to,
+                          type::copy_type cptype ) {
+
+      // The two views need to describe the same type, and be large enough.
+      static_assert( std::is_same< std::remove_cv_t< TYPE1 >, TYPE2 >::value,
+                     "Can only copy between views of the same type" );
+      assert( from.m_size <= to.m_size );
+
+      // Perform the copy.
+      do_copy( from.m_size * sizeof( TYPE1 ), from.m_ptr, to.m_ptr, cptype );
+   }
+
+   template< typename TYPE >
+   data::vector_buffer< std::remove_cv_t< TYPE > >
+   copy::to( const data::vector_view< TYPE >& from, memory_resource& resource,
+             type::copy_type cptype ) {
+
+      // Create the result buffer, and copy the data into it.
+      data::vector_buffer< std::remove_cv_t< TYPE > >
+         result( from.m_size, resource );
+      do_copy( from.m_size * sizeof( TYPE ), from.m_ptr, result.m_ptr,
+               cptype );
+      return result;
+   }
+
+   template< typename TYPE1, typename TYPE2 >
+   copy::event_type copy::async( const data::vector_view< TYPE1 >& from,
+                                 const data::vector_view< TYPE2 >& to,
+                                 type::copy_type cptype ) {
+
+      // The two views need to describe the same type, and be large enough.
+      static_assert( std::is_same< std::remove_cv_t< TYPE1 >, TYPE2 >::value,
+                     "Can only copy between views of the same type" );
+      assert( from.m_size <= to.m_size );
+
+      // Start the copy.
+      return do_copy_async( from.m_size * sizeof( TYPE1 ), from.m_ptr,
+                            to.m_ptr, cptype );
+   }
+
+   template< typename TYPE >
+   data::jagged_vector_buffer< std::remove_cv_t< TYPE > >
+   copy::to( const data::jagged_vector_view< TYPE >& from,
+             memory_resource& resource, type::copy_type cptype ) {
+
+      // Create the result buffer.
+      const details::jagged_vector_layout layout =
+         details::make_jagged_vector_layout( from );
+      data::jagged_vector_buffer< std::remove_cv_t< TYPE > >
+         result( layout.m_rows, layout.m_elements, resource );
+      if( layout.m_total_bytes == 0 ) {
+         return result;
+      }
+
+      // For host-to-host copies pack the data directly into the result.
+      if( cptype == type::host_to_host ) {
+         details::pack_jagged_vector( from, layout, result.memory(),
+                                      result.memory() );
+         return result;
+      }
+
+      // Otherwise pack the data into a staging area on the host first, and
+      // transfer it with a single copy.
+      std::unique_ptr< char[] > staging( new char[ layout.m_total_bytes ] );
+      details::pack_jagged_vector( from, layout, staging.get(),
+                                   result.memory() );
+      do_copy( layout.m_total_bytes, staging.get(), result.memory(), cptype );
+      return result;
+   }
+
+} // namespace vecmem
@@ -0,0 +1,96 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+namespace vecmem {
+
+   /// Collection of memory copies, to be performed together
+   ///
+   /// Copying many small arrays one by one between the host and a device
+   /// pays the full latency of a transfer for every one of them. The copies
+   /// collected by this class are split into two groups instead. The small
+   /// ones are assigned a place in a single, contiguous "packed" memory
+   /// block, so that they can be gathered into it on the source side,
+   /// transferred with a single copy, and scattered from it on the target
+   /// side. The large ones are meant to be performed one by one.
+   ///
+   /// The batch only describes the copies. They are performed by
+   /// @c vecmem::copy, or by the backend specific copy functions.
+   ///
+   class copy_batch {
+
+   public:
+      /// The default size limit for the copies to pack
+      static constexpr std::size_t default_packing_limit = 65536;
+      /// The alignment of the copies inside of the packed memory block
+      static constexpr std::size_t packing_alignment =
+         alignof( std::max_align_t );
+
+      /// Description of one of the copies of the batch
+      struct segment {
+         /// The number of bytes to copy
+         std::size_t m_size;
+         /// The memory block to copy from
+         const void* m_from;
+         /// The memory block to copy to
+         void* m_to;
+         /// The offset of the copy inside of the packed memory block
+         std::size_t m_offset;
+      }; // struct segment
+
+      /// Constructor with the size limit for the copies to pack
+      copy_batch( std::size_t packing_limit = default_packing_limit );
+
+      /// Add the copy of a 1-dimensional array to the batch
+      template< typename TYPE1, typename TYPE2 >
+      void add( const data::vector_view< TYPE1 >& from,
+                const data::vector_view< TYPE2 >& to );
+      /// Add the copy of a raw memory block to the batch
+      ///
+      /// Empty copies are ignored. Copies of at most @c packing_limit bytes
+      /// are packed, the larger ones are performed directly.
+      ///
+      void add( std::size_t size, const void* from, void* to );
+
+      /// Get the size limit for the copies to pack
+      std::size_t packing_limit() const;
+
+      /// Get the copies that are to be packed together
+      const std::vector< segment >& packed() const;
+      /// Get the total size of the packed memory block
+      std::size_t packed_size() const;
+      /// Get the copies that are to be performed directly
+      const std::vector< segment >& direct() const;
+
+      /// Check whether the batch has no copies in it
+      bool empty() const;
+      /// Remove all copies from the batch
+      void clear();
+
+   private:
+      /// The size limit for the copies to pack
+      std::size_t m_packing_limit;
+      /// The copies to pack together
+      std::vector< segment > m_packed;
+      /// The total size of the packed memory block
+      std::size_t m_packed_size;
+      /// The copies to perform directly
+      std::vector< segment > m_direct;
+
+   }; // class copy_batch
+
+} // namespace vecmem
+
+// Include the implementation.
+#include "vecmem/utils/copy_batch.ipp"
@@ -0,0 +1,28 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cassert>
+#include <type_traits>
+
+namespace vecmem {
+
+   template< typename TYPE1, typename TYPE2 >
+   void copy_batch::add( const data::vector_view< TYPE1 >& from,
+                         const data::vector_view< TYPE2 >& to ) {
+
+      // The two views need to describe the same type, and be large enough.
+      static_assert( std::is_same< std::remove_cv_t< TYPE1 >, TYPE2 >::value,
+                     "Can only copy between views of the same type" );
+      assert( from.m_size <= to.m_size );
+
+      // Add the copy of the underlying memory block.
+      add( from.m_size * sizeof( TYPE1 ), from.m_ptr, to.m_ptr );
+   }
+
+} // namespace vecmem
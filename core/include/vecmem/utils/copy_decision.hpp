@@ -0,0 +1,106 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <map>
+
+namespace vecmem {
+
+   /// Kinds of memory that copies can be made between
+   struct memory_kind {
+      /// Enumeration of the different memory kinds
+      enum kind_type {
+         /// Pageable host memory
+         host = 0,
+         /// Pinned (page-locked) host memory
+         pinned_host = 1,
+         /// Device memory, not accessible from the host
+         device = 2,
+         /// Managed (unified) memory, migrating between host and device
+         managed = 3,
+         /// Shared memory, accessible from both the host and the device
+         shared = 4,
+         /// Memory of an unknown kind
+         unknown = 5
+      }; // enum kind_type
+   }; // struct memory_kind
+
+   /// Description of how a memory copy should be performed
+   struct copy_decision {
+      /// Enumeration of the possible ways of performing a copy
+      enum action_type {
+         /// The copy is not needed
+         skip = 0,
+         /// The copy should be done on the host, with @c std::memcpy
+         host_copy = 1,
+         /// The data should just be prefetched to the host or the device
+         prefetch = 2,
+         /// The copy should be done by the backend's runtime
+         runtime_copy = 3,
+         /// The copy should be done by the backend, through a staging pool
+         staged_copy = 4
+      }; // enum action_type
+
+      /// The way to perform the copy
+      action_type m_action;
+      /// The direction of the copy/prefetch
+      copy::type::copy_type m_type;
+
+   }; // struct copy_decision
+
+   /// Decide how a memory copy should be performed
+   ///
+   /// - Empty copies, and copies of a memory block onto itself, are skipped.
+   /// - "Copies" of a managed memory block onto itself, with the other side
+   ///   described as host or device memory, are turned into prefetches of
+   ///   the memory block to that side.
+   /// - Copies between host memory blocks are done with @c std::memcpy.
+   /// - Copies between pageable host memory and device memory are sent
+   ///   through a staging pool, if they are at least @c staging_threshold
+   ///   bytes large. A zero threshold means that no staging pool is
+   ///   available.
+   /// - Everything else is left to the runtime of the backend.
+   ///
+   /// @param size The number of bytes to copy
+   /// @param from_kind The kind of the source memory
+   /// @param from The source memory block
+   /// @param to_kind The kind of the target memory
+   /// @param to The target memory block
+   /// @param staging_threshold The minimum size for staged copies
+   ///
+   copy_decision decide_copy( std::size_t size,
+                              memory_kind::kind_type from_kind,
+                              const void* from,
+                              memory_kind::kind_type to_kind, const void* to,
+                              std::size_t staging_threshold = 0 );
+
+   /// Helper class keeping track of the kind of memory that resources provide
+   class memory_kind_map {
+
+   public:
+      /// Set the kind of memory that a resource provides
+      void set( const memory_resource& resource, memory_kind::kind_type kind );
+      /// Get the kind of memory that a resource provides
+      ///
+      /// @return The kind set for the resource, or
+      ///         @c vecmem::memory_kind::unknown if it was not set
+      ///
+      memory_kind::kind_type get( const memory_resource& resource ) const;
+
+   private:
+      /// The kinds of the known memory resources
+      std::map< const memory_resource*, memory_kind::kind_type > m_kinds;
+
+   }; // class memory_kind_map
+
+} // namespace vecmem
@@ -0,0 +1,28 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem {
+
+   /// Tag type for requesting that a container would not initialise its
+   /// elements
+   ///
+   /// Trivially default constructible elements are left uninitialised by the
+   /// containers receiving this tag, while all other elements are
+   /// default-initialised. This is useful for large output buffers that get
+   /// fully overwritten right after their creation.
+   ///
+   struct no_init_t {
+      /// Explicit default constructor, to avoid accidental conversions
+      explicit no_init_t() = default;
+   };
+
+   /// Tag object for requesting that a container would not initialise its
+   /// elements
+   static constexpr no_init_t no_init{};
+
+} // namespace vecmem
@@ -0,0 +1,186 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/jagged_vector_view.hpp"
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <functional>
+
+/// Host-parallel algorithms operating on vecmem views
+///
+/// All of the algorithms execute their work on a @c vecmem::thread_pool. If
+/// the user does not provide one, a pool shared by the entire process is
+/// used. The views need to describe host accessible memory.
+///
+/// The algorithms operating on jagged vectors split their work according to
+/// the number of elements (and not the number of rows) in the jagged vector,
+/// so that jagged vectors with very unevenly sized rows would still be
+/// processed efficiently.
+///
+namespace vecmem::parallel {
+
+   namespace details {
+
+      /// Get the thread pool used by the algorithms by default
+      thread_pool& default_thread_pool();
+
+   } // namespace details
+
+   /// Call a function on every element of a vector
+   template< typename TYPE, typename FUNCTION >
+   void for_each( const data::vector_view< TYPE >& view, FUNCTION f,
+                  thread_pool& pool = details::default_thread_pool() );
+
+   /// Call a function on every element of a jagged vector
+   template< typename TYPE, typename FUNCTION >
+   void for_each( const data::jagged_vector_view< TYPE >& view, FUNCTION f,
+                  thread_pool& pool = details::default_thread_pool() );
+
+   /// Fill an output vector with a transformation of an input vector
+   ///
+   /// The output vector needs to be at least as large as the input one.
+   ///
+   template< typename TYPE1, typename TYPE2, typename FUNCTION >
+   void transform( const data::vector_view< TYPE1 >& input,
+                   const data::vector_view< TYPE2 >& output, FUNCTION f,
+                   thread_pool& pool = details::default_thread_pool() );
+
+   /// Fill an output jagged vector with a transformation of an input one
+   ///
+   /// Every row of the output jagged vector needs to be at least as large as
+   /// the corresponding row of the input one.
+   ///
+   template< typename TYPE1, typename TYPE2, typename FUNCTION >
+   void transform( const data::jagged_vector_view< TYPE1 >& input,
+                   const data::jagged_vector_view< TYPE2 >& output,
+                   FUNCTION f,
+                   thread_pool& pool = details::default_thread_pool() );
+
+   /// Reduce all elements of a vector using an associative operation
+   template< typename TYPE, typename RESULT,
+             typename BINARY_OP = std::plus<> >
+   RESULT reduce( const data::vector_view< TYPE >& view, RESULT init,
+                  BINARY_OP op = {},
+                  thread_pool& pool = details::default_thread_pool() );
+
+   /// Reduce all elements of a jagged vector using an associative operation
+   template< typename TYPE, typename RESULT,
+             typename BINARY_OP = std::plus<> >
+   RESULT reduce( const data::jagged_vector_view< TYPE >& view, RESULT init,
+                  BINARY_OP op = {},
+                  thread_pool& pool = details::default_thread_pool() );
+
+   /// Calculate the inclusive prefix "sums" of a vector
+   ///
+   /// The output vector needs to be at least as large as the input one. It
+   /// may be the same as the input vector.
+   ///
+   template< typename TYPE1, typename TYPE2,
+             typename BINARY_OP = std::plus<> >
+   void inclusive_scan( const data::vector_view< TYPE1 >& input,
+                        const data::vector_view< TYPE2 >& output,
+                        BINARY_OP op = {},
+                        thread_pool& pool = details::default_thread_pool() );
+
+   /// Calculate the exclusive prefix "sums" of a vector
+   ///
+   /// The output vector needs to be at least as large as the input one. It
+   /// may be the same as the input vector.
+   ///
+   template< typename TYPE1, typename TYPE2, typename RESULT,
+             typename BINARY_OP = std::plus<> >
+   void exclusive_scan( const data::vector_view< TYPE1 >& input,
+                        const data::vector_view< TYPE2 >& output,
+                        RESULT init, BINARY_OP op = {},
+                        thread_pool& pool = details::default_thread_pool() );
+
+   /// Copy the elements of a vector that satisfy a predicate
+   ///
+   /// The relative order of the copied elements is preserved. The predicate
+   /// is evaluated twice for every element, so it must not have side effects.
+   /// The output vector needs to be large enough to receive all of the
+   /// selected elements.
+   ///
+   /// @return The number of elements copied into the output vector
+   ///
+   template< typename TYPE1, typename TYPE2, typename PREDICATE >
+   std::size_t copy_if( const data::vector_view< TYPE1 >& input,
+                        const data::vector_view< TYPE2 >& output,
+                        PREDICATE pred,
+                        thread_pool& pool = details::default_thread_pool() );
+
+   /// Sort the elements of a vector
+   template< typename TYPE, typename COMPARE = std::less<> >
+   void sort( const data::vector_view< TYPE >& view, COMPARE comp = {},
+              thread_pool& pool = details::default_thread_pool() );
+
+   /// Turn the sizes of the rows of a jagged vector into offsets
+   ///
+   /// The output vector needs to have (at least) one more element than the
+   /// input one. Its first element is set to zero, and its last element to
+   /// the sum of all sizes. The scan within every chunk is unrolled, so that
+   /// it would not be limited by the latency of the additions. The output may
+   /// overlap with the input, as long as it starts at the same address.
+   ///
+   /// @return The sum of all sizes
+   ///
+   std::size_t
+   make_offsets( const data::vector_view< const std::size_t >& sizes,
+                 const data::vector_view< std::size_t >& offsets,
+                 thread_pool& pool = details::default_thread_pool() );
+
+   /// Create a jagged vector buffer with the specified row sizes
+   ///
+   /// The views of the buffer are set up in parallel, while the elements of
+   /// the buffer are left uninitialised.
+   ///
+   template< typename TYPE >
+   data::jagged_vector_buffer< TYPE >
+   make_jagged_vector_buffer(
+      const data::vector_view< const std::size_t >& sizes,
+      memory_resource& resource,
+      thread_pool& pool = details::default_thread_pool() );
+
+   /// Create and fill a jagged vector buffer with the specified row sizes
+   ///
+   /// The views of the buffer are set up in parallel, and then every element
+   /// is set to the value returned by @c f(row,column). The filling is
+   /// balanced by the number of elements, not by the number of rows.
+   ///
+   template< typename TYPE, typename FUNCTION >
+   data::jagged_vector_buffer< TYPE >
+   make_jagged_vector_buffer(
+      const data::vector_view< const std::size_t >& sizes, FUNCTION f,
+      memory_resource& resource,
+      thread_pool& pool = details::default_thread_pool() );
+
+   /// Create a view of a jagged vector, setting up its row views in parallel
+   ///
+   /// This is an alternative to @c vecmem::data::jagged_vector_data for
+   /// jagged vectors with very many rows. The row views are written into
+   /// memory provided by the caller, which needs to have at least as many
+   /// elements as @c vec, and which needs to outlive the returned view.
+   ///
+   template< typename TYPE >
+   data::jagged_vector_view< TYPE >
+   make_jagged_vector_view(
+      jagged_vector< TYPE >& vec,
+      const data::vector_view< data::vector_view< TYPE > >& storage,
+      thread_pool& pool = details::default_thread_pool() );
+
+} // namespace vecmem::parallel
+
+// Include the implementation.
+#include "vecmem/utils/parallel_algorithms.ipp"
@@ -0,0 +1,481 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace vecmem::parallel {
+
+   namespace details {
+
+      /// The smallest number of elements worth processing as a separate task
+      static constexpr std::size_t minimal_grain_size = 1024;
+
+      /// Decide how many elements to process in one task
+      inline std::size_t grain_size( std::size_t size,
+                                     const thread_pool& pool ) {
+
+         return std::max( size / ( 4 * pool.size() ), minimal_grain_size );
+      }
+
+      /// Get the number of tasks needed for processing some elements
+      inline std::size_t chunk_count( std::size_t size, std::size_t grain ) {
+
+         return ( size + grain - 1 ) / grain;
+      }
+
+      /// Get the offsets of the rows of a jagged vector in "element space"
+      template< typename TYPE >
+      std::vector< std::size_t >
+      row_offsets( const data::jagged_vector_view< TYPE >& view ) {
+
+         std::vector< std::size_t > result( view.m_size + 1, 0 );
+         for( std::size_t i = 0; i < view.m_size; ++i ) {
+            result[ i + 1 ] = result[ i ] + view.m_ptr[ i ].m_size;
+         }
+         return result;
+      }
+
+      /// Call a function on the row pieces of an element range
+      ///
+      /// The function receives the index of the row, and the range of column
+      /// indices in that row, that fall into the [begin, end) element range.
+      ///
+      template< typename FUNCTION >
+      void for_each_row_range( const std::vector< std::size_t >& offsets,
+                               std::size_t begin, std::size_t end,
+                               FUNCTION f ) {
+
+         // Find the row holding the first element.
+         std::size_t row = static_cast< std::size_t >(
+            std::upper_bound( offsets.begin(), offsets.end(), begin ) -
+            offsets.begin() ) - 1;
+         // Walk through all the rows overlapping with the range.
+         while( begin < end ) {
+            const std::size_t stop = std::min( end, offsets[ row + 1 ] );
+            if( stop > begin ) {
+               f( row, begin - offsets[ row ], stop - offsets[ row ] );
+               begin = stop;
+            }
+            ++row;
+         }
+      }
+
+      /// Create a jagged vector buffer, and set up its views
+      template< typename TYPE >
+      data::jagged_vector_buffer< TYPE >
+      make_jagged_vector_buffer(
+         const data::vector_view< const std::size_t >& sizes,
+         std::vector< std::size_t >& offsets, memory_resource& resource,
+         thread_pool& pool ) {
+
+         // Calculate where each row would start in the payload.
+         const std::size_t rows = sizes.m_size;
+         offsets.resize( rows + 1 );
+         const std::size_t elements =
+            make_offsets( sizes, { offsets.size(), offsets.data() }, pool );
+
+         // Allocate the buffer, and set up its views.
+         data::jagged_vector_buffer< TYPE > result( rows, elements, resource );
+         data::vector_view< TYPE >* views = result.m_ptr;
+         TYPE* payload = reinterpret_cast< TYPE* >(
+            static_cast< char* >( result.memory() ) +
+            result.layout().m_payload_offset );
+         const std::size_t* sizes_ptr = sizes.m_ptr;
+         const std::size_t* offsets_ptr = offsets.data();
+         pool.parallel_for( rows,
+            [ views, payload, sizes_ptr, offsets_ptr ]( std::size_t begin,
+                                                        std::size_t end ) {
+               for( std::size_t i = begin; i < end; ++i ) {
+                  new( views + i ) data::vector_view< TYPE >(
+                     sizes_ptr[ i ], payload + offsets_ptr[ i ] );
+               }
+            },
+            grain_size( rows, pool ) );
+         return result;
+      }
+
+   } // namespace details
+
+   template< typename TYPE, typename FUNCTION >
+   void for_each( const data::vector_view< TYPE >& view, FUNCTION f,
+                  thread_pool& pool ) {
+
+      TYPE* ptr = view.m_ptr;
+      pool.parallel_for( view.m_size,
+                         [ ptr, &f ]( std::size_t begin, std::size_t end ) {
+                            for( std::size_t i = begin; i < end; ++i ) {
+                               f( ptr[ i ] );
+                            }
+                         },
+                         details::grain_size( view.m_size, pool ) );
+   }
+
+   template< typename TYPE, typename FUNCTION >
+   void for_each( const data::jagged_vector_view< TYPE >& view, FUNCTION f,
+                  thread_pool& pool ) {
+
+      const std::vector< std::size_t > offsets = details::row_offsets( view );
+      const std::size_t size = offsets.back();
+      pool.parallel_for( size,
+         [ &view, &offsets, &f ]( std::size_t begin, std::size_t end ) {
+            details::for_each_row_range( offsets, begin, end,
+               [ &view, &f ]( std::size_t row, std::size_t first,
+                              std::size_t last ) {
+                  TYPE* ptr = view.m_ptr[ row ].m_ptr;
+                  for( std::size_t i = first; i < last; ++i ) {
+                     f( ptr[ i ] );
+                  }
+               } );
+         },
+         details::grain_size( size, pool ) );
+   }
+
+   template< typename TYPE1, typename TYPE2, typename FUNCTION >
+   void transform( const data::vector_view< TYPE1 >& input,
+                   const data::vector_view< TYPE2 >& output, FUNCTION f,
+                   thread_pool& pool ) {
+
+      assert( input.m_size <= output.m_size );
+      TYPE1* in = input.m_ptr;
+      TYPE2* out = output.m_ptr;
+      pool.parallel_for( input.m_size,
+                         [ in, out, &f ]( std::size_t begin, std::size_t end ) {
+                            for( std::size_t i = begin; i < end; ++i ) {
+                               out[ i ] = f( in[ i ] );
+                            }
+                         },
+                         details::grain_size( input.m_size, pool ) );
+   }
+
+   template< typename TYPE1, typename TYPE2, typename FUNCTION >
+   void transform( const data::jagged_vector_view< TYPE1 >& input,
+                   const data::jagged_vector_view< TYPE2 >& output,
+                   FUNCTION f, thread_pool& pool ) {
+
+      assert( input.m_size <= output.m_size );
+      const std::vector< std::size_t > offsets = details::row_offsets( input );
+      const std::size_t size = offsets.back();
+      pool.parallel_for( size,
+         [ &input, &output, &offsets, &f ]( std::size_t begin,
+                                            std::size_t end ) {
+            details::for_each_row_range( offsets, begin, end,
+               [ &input, &output, &f ]( std::size_t row, std::size_t first,
+                                        std::size_t last ) {
+                  assert( input.m_ptr[ row ].m_size <=
+                          output.m_ptr[ row ].m_size );
+                  TYPE1* in = input.m_ptr[ row ].m_ptr;
+                  TYPE2* out = output.m_ptr[ row ].m_ptr;
+                  for( std::size_t i = first; i < last; ++i ) {
+                     out[ i ] = f( in[ i ] );
+                  }
+               } );
+         },
+         details::grain_size( size, pool ) );
+   }
+
+   template< typename TYPE, typename RESULT, typename BINARY_OP >
+   RESULT reduce( const data::vector_view< TYPE >& view, RESULT init,
+                  BINARY_OP op, thread_pool& pool ) {
+
+      // Reduce every chunk separately.
+      const std::size_t grain = details::grain_size( view.m_size, pool );
+      std::vector< RESULT > partials( details::chunk_count( view.m_size,
+                                                            grain ), init );
+      TYPE* ptr = view.m_ptr;
+      pool.parallel_for( view.m_size,
+         [ ptr, grain, &partials, &op ]( std::size_t begin,
+                                         std::size_t end ) {
+            RESULT result = ptr[ begin ];
+            for( std::size_t i = begin + 1; i < end; ++i ) {
+               result = op( result, ptr[ i ] );
+            }
+            partials[ begin / grain ] = result;
+         },
+         grain );
+
+      // Combine the results of the chunks.
+      for( const RESULT& partial : partials ) {
+         init = op( init, partial );
+      }
+      return init;
+   }
+
+   template< typename TYPE, typename RESULT, typename BINARY_OP >
+   RESULT reduce( const data::jagged_vector_view< TYPE >& view, RESULT init,
+                  BINARY_OP op, thread_pool& pool ) {
+
+      // Reduce every chunk separately.
+      const std::vector< std::size_t > offsets = details::row_offsets( view );
+      const std::size_t size = offsets.back();
+      const std::size_t grain = details::grain_size( size, pool );
+      std::vector< RESULT > partials( details::chunk_count( size, grain ),
+                                      init );
+      pool.parallel_for( size,
+         [ &view, &offsets, grain, &partials, &op ]( std::size_t begin,
+                                                     std::size_t end ) {
+            RESULT& result = partials[ begin / grain ];
+            bool first_element = true;
+            details::for_each_row_range( offsets, begin, end,
+               [ &view, &op, &result, &first_element ]( std::size_t row,
+                                                        std::size_t first,
+                                                        std::size_t last ) {
+                  TYPE* ptr = view.m_ptr[ row ].m_ptr;
+                  if( first_element ) {
+                     result = ptr[ first++ ];
+                     first_element = false;
+                  }
+                  for( std::size_t i = first; i < last; ++i ) {
+                     result = op( result, ptr[ i ] );
+                  }
+               } );
+         },
+         grain );
+
+      // Combine the results of the chunks.
+      for( const RESULT& partial : partials ) {
+         init = op( init, partial );
+      }
+      return init;
+   }
+
+   template< typename TYPE1, typename TYPE2, typename BINARY_OP >
+   void inclusive_scan( const data::vector_view< TYPE1 >& input,
+                        const data::vector_view< TYPE2 >& output,
+                        BINARY_OP op, thread_pool& pool ) {
+
+      assert( input.m_size <= output.m_size );
+      typedef std::remove_cv_t< TYPE2 > value_type;
+      const std::size_t size = input.m_size;
+      const std::size_t grain = details::grain_size( size, pool );
+      const std::size_t chunks = details::chunk_count( size, grain );
+      TYPE1* in = input.m_ptr;
+      TYPE2* out = output.m_ptr;
+
+      // Calculate the "sum" of every chunk but the last one, and from those
+      // the value that each chunk needs to start from.
+      std::vector< value_type > carries( chunks );
+      if( chunks > 1 ) {
+         pool.parallel_for( ( chunks - 1 ) * grain,
+            [ in, grain, &carries, &op ]( std::size_t begin,
+                                          std::size_t end ) {
+               value_type sum = in[ begin ];
+               for( std::size_t i = begin + 1; i < end; ++i ) {
+                  sum = op( sum, in[ i ] );
+               }
+               carries[ begin / grain + 1 ] = sum;
+            },
+            grain );
+         for( std::size_t i = 2; i < chunks; ++i ) {
+            carries[ i ] = op( carries[ i - 1 ], carries[ i ] );
+         }
+      }
+
+      // Calculate the final results in every chunk.
+      pool.parallel_for( size,
+         [ in, out, grain, &carries, &op ]( std::size_t begin,
+                                            std::size_t end ) {
+            value_type sum = ( ( begin == 0 ) ? value_type( in[ begin ] ) :
+                               op( carries[ begin / grain ], in[ begin ] ) );
+            out[ begin ] = sum;
+            for( std::size_t i = begin + 1; i < end; ++i ) {
+               sum = op( sum, in[ i ] );
+               out[ i ] = sum;
+            }
+         },
+         grain );
+   }
+
+   template< typename TYPE1, typename TYPE2, typename RESULT,
+             typename BINARY_OP >
+   void exclusive_scan( const data::vector_view< TYPE1 >& input,
+                        const data::vector_view< TYPE2 >& output,
+                        RESULT init, BINARY_OP op, thread_pool& pool ) {
+
+      assert( input.m_size <= output.m_size );
+      typedef std::remove_cv_t< TYPE2 > value_type;
+      const std::size_t size = input.m_size;
+      const std::size_t grain = details::grain_size( size, pool );
+      const std::size_t chunks = details::chunk_count( size, grain );
+      TYPE1* in = input.m_ptr;
+      TYPE2* out = output.m_ptr;
+
+      // Calculate the "sum" of every chunk but the last one, and from those
+      // the value that each chunk needs to start from.
+      std::vector< value_type > carries( chunks, init );
+      if( chunks > 1 ) {
+         pool.parallel_for( ( chunks - 1 ) * grain,
+            [ in, grain, &carries, &op ]( std::size_t begin,
+                                          std::size_t end ) {
+               value_type sum = in[ begin ];
+               for( std::size_t i = begin + 1; i < end; ++i ) {
+                  sum = op( sum, in[ i ] );
+               }
+               carries[ begin / grain + 1 ] = sum;
+            },
+            grain );
+         for( std::size_t i = 1; i < chunks; ++i ) {
+            carries[ i ] = op( carries[ i - 1 ], carries[ i ] );
+         }
+      }
+
+      // Calculate the final results in every chunk.
+      pool.parallel_for( size,
+         [ in, out, grain, &carries, &op ]( std::size_t begin,
+                                            std::size_t end ) {
+            value_type sum = carries[ begin / grain ];
+            for( std::size_t i = begin; i < end; ++i ) {
+               const value_type value = in[ i ];
+               out[ i ] = sum;
+               sum = op( sum, value );
+            }
+         },
+         grain );
+   }
+
+   template< typename TYPE1, typename TYPE2, typename PREDICATE >
+   std::size_t copy_if( const data::vector_view< TYPE1 >& input,
+                        const data::vector_view< TYPE2 >& output,
+                        PREDICATE pred, thread_pool& pool ) {
+
+      const std::size_t grain = details::grain_size( input.m_size, pool );
+      const std::size_t chunks = details::chunk_count( input.m_size, grain );
+      TYPE1* in = input.m_ptr;
+      TYPE2* out = output.m_ptr;
+
+      // Count the selected elements in every chunk.
+      std::vector< std::size_t > offsets( chunks + 1, 0 );
+      pool.parallel_for( input.m_size,
+         [ in, grain, &offsets, &pred ]( std::size_t begin,
+                                         std::size_t end ) {
+            std::size_t count = 0;
+            for( std::size_t i = begin; i < end; ++i ) {
+               count += ( pred( in[ i ] ) ? 1 : 0 );
+            }
+            offsets[ begin / grain + 1 ] = count;
+         },
+         grain );
+      for( std::size_t i = 1; i <= chunks; ++i ) {
+         offsets[ i ] += offsets[ i - 1 ];
+      }
+      assert( offsets.back() <= output.m_size );
+
+      // Copy the selected elements into their final place.
+      pool.parallel_for( input.m_size,
+         [ in, out, grain, &offsets, &pred ]( std::size_t begin,
+                                              std::size_t end ) {
+            std::size_t target = offsets[ begin / grain ];
+            for( std::size_t i = begin; i < end; ++i ) {
+               if( pred( in[ i ] ) ) {
+                  out[ target++ ] = in[ i ];
+               }
+            }
+         },
+         grain );
+      return offsets.back();
+   }
+
+   template< typename TYPE, typename COMPARE >
+   void sort( const data::vector_view< TYPE >& view, COMPARE comp,
+              thread_pool& pool ) {
+
+      const std::size_t size = view.m_size;
+      const std::size_t grain = details::grain_size( size, pool );
+      TYPE* ptr = view.m_ptr;
+
+      // Sort every chunk separately.
+      pool.parallel_for( size,
+                         [ ptr, &comp ]( std::size_t begin, std::size_t end ) {
+                            std::sort( ptr + begin, ptr + end, comp );
+                         },
+                         grain );
+
+      // Merge the sorted chunks pairwise, until only one is left.
+      for( std::size_t width = grain; width < size; width *= 2 ) {
+         pool.parallel_for( details::chunk_count( size, 2 * width ),
+            [ ptr, size, width, &comp ]( std::size_t begin,
+                                         std::size_t end ) {
+               for( std::size_t i = begin; i < end; ++i ) {
+                  const std::size_t first = i * 2 * width;
+                  const std::size_t middle = std::min( first + width, size );
+                  const std::size_t last = std::min( middle + width, size );
+                  std::inplace_merge( ptr + first, ptr + middle, ptr + last,
+                                      comp );
+               }
+            },
+            1 );
+      }
+   }
+
+   template< typename TYPE >
+   data::jagged_vector_buffer< TYPE >
+   make_jagged_vector_buffer(
+      const data::vector_view< const std::size_t >& sizes,
+      memory_resource& resource, thread_pool& pool ) {
+
+      std::vector< std::size_t > offsets;
+      return details::make_jagged_vector_buffer< TYPE >( sizes, offsets,
+                                                         resource, pool );
+   }
+
+   template< typename TYPE, typename FUNCTION >
+   data::jagged_vector_buffer< TYPE >
+   make_jagged_vector_buffer(
+      const data::vector_view< const std::size_t >& sizes, FUNCTION f,
+      memory_resource& resource, thread_pool& pool ) {
+
+      // Create the buffer.
+      std::vector< std::size_t > offsets;
+      data::jagged_vector_buffer< TYPE > result =
+         details::make_jagged_vector_buffer< TYPE >( sizes, offsets, resource,
+                                                     pool );
+
+      // Fill all of its elements.
+      const data::vector_view< TYPE >* views = result.m_ptr;
+      pool.parallel_for( offsets.back(),
+         [ views, &offsets, &f ]( std::size_t begin, std::size_t end ) {
+            details::for_each_row_range( offsets, begin, end,
+               [ views, &f ]( std::size_t row, std::size_t first,
+                              std::size_t last ) {
+                  TYPE* ptr = views[ row ].m_ptr;
+                  for( std::size_t i = first; i < last; ++i ) {
+                     new( ptr + i ) TYPE( f( row, i ) );
+                  }
+               } );
+         },
+         details::grain_size( offsets.back(), pool ) );
+      return result;
+   }
+
+   template< typename TYPE >
+   data::jagged_vector_view< TYPE >
+   make_jagged_vector_view(
+      jagged_vector< TYPE >& vec,
+      const data::vector_view< data::vector_view< TYPE > >& storage,
+      thread_pool& pool ) {
+
+      assert( vec.size() <= storage.m_size );
+      const std::size_t rows = vec.size();
+      vecmem::vector< TYPE >* inner = vec.data();
+      data::vector_view< TYPE >* views = storage.m_ptr;
+      pool.parallel_for( rows,
+         [ inner, views ]( std::size_t begin, std::size_t end ) {
+            for( std::size_t i = begin; i < end; ++i ) {
+               new( views + i ) data::vector_view< TYPE >(
+                  inner[ i ].size(), inner[ i ].data() );
+            }
+         },
+         details::grain_size( rows, pool ) );
+      return { rows, views };
+   }
+
+} // namespace vecmem::parallel
@@ -0,0 +1,113 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/deallocator.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace vecmem {
+
+   /// Reusable pool of staging buffers, for pipelined host<->device copies
+   ///
+   /// Copies between pageable host memory and device memory are slow, since
+   /// the backend runtimes need to route them through (small) internal
+   /// buffers of pinned memory. This pool holds a few larger "slots" of
+   /// memory, allocated once from a (pinned) host memory resource, like
+   /// @c vecmem::cuda::host_memory_resource. Large copies are split into
+   /// slot sized chunks, and while one chunk is being transferred between
+   /// a slot and the device, the next chunk is copied between the host
+   /// memory and the next slot. With (at least) two slots, this hides the
+   /// cost of the host-side copies almost entirely.
+   ///
+   /// The pool itself is independent of the backends. The device transfers
+   /// are performed through the @c vecmem::staging_pool::transfer interface,
+   /// implemented by the backend specific code.
+   ///
+   /// Only one copy can use the pool at a time. Concurrent copies are
+   /// serialised.
+   ///
+   class staging_pool {
+
+   public:
+      /// The default size of the slots
+      static constexpr std::size_t default_slot_size = 4194304;
+      /// The default number of slots
+      static constexpr std::size_t default_slot_count = 2;
+
+      /// Interface for the backend specific transfers of the pool
+      class transfer {
+
+      public:
+         /// Virtual destructor
+         virtual ~transfer();
+
+         /// Start an asynchronous transfer between a slot and the device
+         ///
+         /// Either @c from or @c to points into the memory of the slot.
+         ///
+         /// @param slot The index of the slot taking part in the transfer
+         /// @param size The number of bytes to transfer
+         /// @param from The memory to transfer the data from
+         /// @param to The memory to transfer the data to
+         ///
+         virtual void start( std::size_t slot, std::size_t size,
+                             const void* from, void* to ) = 0;
+         /// Wait for the last transfer started on a slot to finish
+         virtual void wait( std::size_t slot ) = 0;
+
+      }; // class transfer
+
+      /// Constructor with the (pinned) host memory resource to use
+      ///
+      /// @param resource The memory resource to allocate the slots from
+      /// @param slot_size The size of the individual slots in bytes
+      /// @param slot_count The number of slots to allocate
+      ///
+      staging_pool( memory_resource& resource,
+                    std::size_t slot_size = default_slot_size,
+                    std::size_t slot_count = default_slot_count );
+
+      /// Get the size of the individual slots
+      std::size_t slot_size() const;
+      /// Get the number of slots in the pool
+      std::size_t slot_count() const;
+
+      /// Copy a host memory block to the device, through the pool
+      ///
+      /// The function returns once all of the transfers finished.
+      ///
+      void to_device( std::size_t size, const void* from, void* to,
+                      transfer& xfer );
+      /// Copy a device memory block to the host, through the pool
+      ///
+      /// The function returns once all of the data arrived in @c to.
+      ///
+      void to_host( std::size_t size, const void* from, void* to,
+                    transfer& xfer );
+
+   private:
+      /// Get a pointer to one of the slots
+      char* slot( std::size_t index );
+
+      /// The size of the individual slots
+      std::size_t m_slot_size;
+      /// The number of slots
+      std::size_t m_slot_count;
+      /// The memory of all slots, in a single block
+      std::unique_ptr< char, details::deallocator > m_memory;
+      /// Mutex serialising the copies using the pool
+      std::mutex m_mutex;
+
+   }; // class staging_pool
+
+} // namespace vecmem
@@ -0,0 +1,112 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vecmem {
+
+   /// Work-stealing pool of host threads executing tasks in the background
+   ///
+   /// It is used by the host backends of the library to execute work
+   /// asynchronously, and/or in parallel. Every worker thread has its own task
+   /// queue. Tasks submitted from outside of the pool are distributed among
+   /// the queues in a round-robin fashion, while tasks submitted by a worker
+   /// thread end up in its own queue. Workers execute the tasks from their own
+   /// queue in submission order, and steal tasks from the back of the other
+   /// queues once they ran out of work.
+   ///
+   class thread_pool {
+
+   public:
+      /// Type of the tasks executed by the pool
+      typedef std::function< void() > task_type;
+      /// Type of the tasks processing a range of indices
+      typedef std::function< void( std::size_t, std::size_t ) > range_task_type;
+
+      /// Constructor with the number of worker threads to launch
+      ///
+      /// If zero threads are requested, the pool launches as many threads as
+      /// there are hardware threads available on the host.
+      ///
+      thread_pool( std::size_t threads = 0 );
+      /// Destructor, waiting for all submitted tasks to finish
+      ~thread_pool();
+
+      /// The pool can not be copied
+      thread_pool( const thread_pool& ) = delete;
+      /// The pool can not be copied
+      thread_pool& operator=( const thread_pool& ) = delete;
+
+      /// Get the number of worker threads in the pool
+      std::size_t size() const;
+
+      /// Submit a task for asynchronous execution
+      void submit( task_type task );
+
+      /// Process the index range [0, size) in parallel
+      ///
+      /// The range is split into chunks of @c grain indices, which are
+      /// processed by the worker threads and by the calling thread itself,
+      /// each thread picking up the next unprocessed chunk once it finished
+      /// with its previous one. The function returns once all chunks were
+      /// processed. Since the calling thread takes part in the processing, it
+      /// is safe to call this function from inside of a task running on the
+      /// pool.
+      ///
+      /// @param size The number of indices to process
+      /// @param task The function processing the index range [begin, end)
+      /// @param grain The number of indices in one chunk, or zero to let the
+      ///              pool choose
+      ///
+      /// @throws Whatever exception was thrown by @c task (the first one, if
+      ///         multiple chunks failed)
+      ///
+      void parallel_for( std::size_t size, const range_task_type& task,
+                         std::size_t grain = 0 );
+
+   private:
+      /// Task queue belonging to one worker thread
+      struct worker_queue {
+         /// Mutex protecting the queue
+         std::mutex m_mutex;
+         /// Tasks waiting for execution
+         std::deque< task_type > m_tasks;
+      };
+
+      /// Function executed by each of the worker threads
+      void run( std::size_t index );
+      /// Try to take a task, from the specified queue first
+      bool try_pop( std::size_t index, task_type& task );
+
+      /// Mutex used for putting idle workers to sleep
+      std::mutex m_mutex;
+      /// Condition variable used to wake up the worker threads
+      std::condition_variable m_condition;
+      /// The number of tasks waiting for execution in all of the queues
+      std::atomic< std::size_t > m_pending;
+      /// Counter used to distribute tasks among the queues
+      std::atomic< std::size_t > m_next_queue;
+      /// The task queues of the worker threads
+      std::vector< std::unique_ptr< worker_queue > > m_queues;
+      /// Flag telling the worker threads to stop
+      bool m_stop;
+      /// The worker threads
+      std::vector< std::thread > m_threads;
+
+   }; // class thread_pool
+
+} // namespace vecmem
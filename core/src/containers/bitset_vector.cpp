@@ -0,0 +1,141 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/bitset_vector.hpp"
+#include "vecmem/containers/device_bitset.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+
+namespace {
+
+   /// Type of the words holding the bits
+   typedef vecmem::data::bitset_view::word_type word_type;
+
+   /// Combine the words of two bitsets
+   ///
+   /// The loop is kept trivial, so that the compiler would vectorise it.
+   ///
+   template< typename OPERATION >
+   void combine( std::size_t count, word_type* lhs, const word_type* rhs,
+                 OPERATION op ) {
+
+      for( std::size_t i = 0; i < count; ++i ) {
+         lhs[ i ] = op( lhs[ i ], rhs[ i ] );
+      }
+   }
+
+} // private namespace
+
+namespace vecmem {
+
+   bitset_vector::bitset_vector( size_type size, memory_resource& resource,
+                                 bool value )
+   : m_size( size ),
+     m_words( data::bitset_view::word_count( size ), resource ) {
+
+      fill( value );
+   }
+
+   bool bitset_vector::test( size_type pos ) const {
+
+      return device_bitset( data() ).test( pos );
+   }
+
+   bool bitset_vector::operator[]( size_type pos ) const {
+
+      return test( pos );
+   }
+
+   void bitset_vector::set( size_type pos ) {
+
+      device_bitset( data() ).set( pos );
+   }
+
+   void bitset_vector::reset( size_type pos ) {
+
+      device_bitset( data() ).reset( pos );
+   }
+
+   bool bitset_vector::test_and_set( size_type pos ) {
+
+      return device_bitset( data() ).test_and_set( pos );
+   }
+
+   bitset_vector::size_type bitset_vector::size() const {
+
+      return m_size;
+   }
+
+   bitset_vector::size_type bitset_vector::count() const {
+
+      return device_bitset( data() ).count();
+   }
+
+   bool bitset_vector::any() const {
+
+      return std::any_of( m_words.m_ptr, m_words.m_ptr + m_words.m_size,
+                          []( word_type word ) { return word != 0; } );
+   }
+
+   bool bitset_vector::none() const {
+
+      return ( ! any() );
+   }
+
+   void bitset_vector::fill( bool value ) {
+
+      std::fill( m_words.m_ptr, m_words.m_ptr + m_words.m_size,
+                 ( value ? ~word_type( 0 ) : word_type( 0 ) ) );
+      clear_tail();
+   }
+
+   bitset_vector& bitset_vector::operator&=( const data::bitset_view& rhs ) {
+
+      assert( rhs.m_size == m_size );
+      ::combine( m_words.m_size, m_words.m_ptr, rhs.m_words,
+                 []( word_type a, word_type b ) { return a & b; } );
+      return *this;
+   }
+
+   bitset_vector& bitset_vector::operator|=( const data::bitset_view& rhs ) {
+
+      assert( rhs.m_size == m_size );
+      ::combine( m_words.m_size, m_words.m_ptr, rhs.m_words,
+                 []( word_type a, word_type b ) { return a | b; } );
+      return *this;
+   }
+
+   bitset_vector& bitset_vector::operator^=( const data::bitset_view& rhs ) {
+
+      assert( rhs.m_size == m_size );
+      ::combine( m_words.m_size, m_words.m_ptr, rhs.m_words,
+                 []( word_type a, word_type b ) { return a ^ b; } );
+      return *this;
+   }
+
+   data::bitset_view bitset_vector::data() const {
+
+      return { m_size, m_words.m_ptr };
+   }
+
+   void bitset_vector::clear_tail() {
+
+      const size_type used = m_size % data::bitset_view::word_bits;
+      if( used != 0 ) {
+         m_words.m_ptr[ m_words.m_size - 1 ] &= ( ( 1u << used ) - 1u );
+      }
+   }
+
+   data::bitset_view get_data( bitset_vector& bits ) {
+
+      return bits.data();
+   }
+
+} // namespace vecmem
@@ -0,0 +1,185 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/io/binary_format.hpp"
+
+// System include(s).
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+   /// The magic bytes at the start of every file
+   static constexpr char binary_magic[ 8 ] = { 'V', 'E', 'C', 'M',
+                                               'E', 'M', 'B', 'F' };
+   /// The current version of the file format
+   static constexpr std::uint32_t binary_version = 1;
+
+   /// The largest number of rows that a file may describe
+   ///
+   /// Chosen such that the offset of the payload, including its alignment,
+   /// could not overflow.
+   ///
+   static constexpr std::uint64_t binary_max_rows =
+      ( ( std::numeric_limits< std::size_t >::max() -
+          sizeof( vecmem::io::binary_header ) -
+          vecmem::io::binary_payload_alignment ) /
+        sizeof( std::uint64_t ) ) - 1;
+
+   /// Get the size of the offset array in the file
+   std::size_t offsets_size( const vecmem::io::binary_header& header ) {
+
+      if( header.m_content == vecmem::io::binary_content::jagged_vector ) {
+         if( header.m_rows > ::binary_max_rows ) {
+            throw std::runtime_error( "Corrupt header in vecmem binary "
+                                      "file" );
+         }
+         return ( header.m_rows + 1 ) * sizeof( std::uint64_t );
+      }
+      return 0;
+   }
+
+} // private namespace
+
+namespace vecmem::io::details {
+
+   binary_header make_binary_header( binary_content content,
+                                     std::size_t element_size,
+                                     std::size_t rows,
+                                     std::size_t elements ) {
+
+      binary_header result;
+      std::memcpy( result.m_magic, ::binary_magic, sizeof( ::binary_magic ) );
+      result.m_version = ::binary_version;
+      result.m_content = content;
+      result.m_element_size = element_size;
+      result.m_rows = rows;
+      result.m_elements = elements;
+      return result;
+   }
+
+   void check_binary_header( const binary_header& header,
+                             binary_content content,
+                             std::size_t element_size ) {
+
+      if( std::memcmp( header.m_magic, ::binary_magic,
+                       sizeof( ::binary_magic ) ) != 0 ) {
+         throw std::runtime_error( "Not a vecmem binary file" );
+      }
+      if( header.m_version != ::binary_version ) {
+         throw std::runtime_error( "Unsupported vecmem binary file version: " +
+                                   std::to_string( header.m_version ) );
+      }
+      if( header.m_content != content ) {
+         throw std::runtime_error( "Unexpected content in vecmem binary "
+                                   "file" );
+      }
+      if( header.m_element_size != element_size ) {
+         throw std::runtime_error( "Element size mismatch in vecmem binary "
+                                   "file: " +
+                                   std::to_string( header.m_element_size ) +
+                                   " != " + std::to_string( element_size ) );
+      }
+      // Make sure that the sizes derived from the header would not overflow.
+      if( ( ( element_size != 0 ) &&
+            ( header.m_elements >
+              std::numeric_limits< std::size_t >::max() / element_size ) ) ||
+          ( header.m_rows > ::binary_max_rows ) ) {
+         throw std::runtime_error( "Corrupt header in vecmem binary file" );
+      }
+   }
+
+   void check_binary_offsets( const binary_header& header,
+                              const std::uint64_t* offsets ) {
+
+      if( offsets[ 0 ] != 0 ) {
+         throw std::runtime_error( "Corrupt offsets in vecmem binary file" );
+      }
+      for( std::size_t i = 0; i < header.m_rows; ++i ) {
+         if( offsets[ i + 1 ] < offsets[ i ] ) {
+            throw std::runtime_error( "Corrupt offsets in vecmem binary "
+                                      "file" );
+         }
+      }
+      if( offsets[ header.m_rows ] != header.m_elements ) {
+         throw std::runtime_error( "Corrupt offsets in vecmem binary file" );
+      }
+   }
+
+   std::size_t binary_payload_offset( const binary_header& header ) {
+
+      const std::size_t offset = sizeof( binary_header ) +
+                                 ::offsets_size( header );
+      return ( ( offset + binary_payload_alignment - 1 ) /
+               binary_payload_alignment ) * binary_payload_alignment;
+   }
+
+   void write_binary_header( std::ostream& out, const binary_header& header,
+                             const std::uint64_t* offsets ) {
+
+      // Write the header, and the offsets.
+      out.write( reinterpret_cast< const char* >( &header ),
+                 sizeof( binary_header ) );
+      const std::size_t osize = ::offsets_size( header );
+      if( osize != 0 ) {
+         out.write( reinterpret_cast< const char* >( offsets ), osize );
+      }
+
+      // Pad the output up to the start of the payload.
+      static const char padding[ binary_payload_alignment ] = {};
+      out.write( padding, binary_payload_offset( header ) -
+                          sizeof( binary_header ) - osize );
+      if( ! out ) {
+         throw std::runtime_error( "Failed to write vecmem binary header" );
+      }
+   }
+
+   binary_header read_binary_header( std::istream& in ) {
+
+      binary_header result;
+      in.read( reinterpret_cast< char* >( &result ), sizeof( binary_header ) );
+      if( ! in ) {
+         throw std::runtime_error( "Failed to read vecmem binary header" );
+      }
+      return result;
+   }
+
+   void skip_binary_padding( std::istream& in, const binary_header& header ) {
+
+      in.ignore( binary_payload_offset( header ) - sizeof( binary_header ) -
+                 ::offsets_size( header ) );
+      if( ! in ) {
+         throw std::runtime_error( "Failed to read vecmem binary file" );
+      }
+   }
+
+   binary_header skip_to_binary_payload( std::istream& in,
+                                         std::size_t element_size ) {
+
+      // Read and check the header.
+      const binary_header header = read_binary_header( in );
+      check_binary_header( header, header.m_content, element_size );
+      if( ( header.m_content != binary_content::vector ) &&
+          ( header.m_content != binary_content::jagged_vector ) ) {
+         throw std::runtime_error( "Unexpected content in vecmem binary "
+                                   "file" );
+      }
+
+      // Skip the offsets and the padding.
+      in.ignore( binary_payload_offset( header ) - sizeof( binary_header ) );
+      if( ! in ) {
+         throw std::runtime_error( "Failed to read vecmem binary file" );
+      }
+      return header;
+   }
+
+} // namespace vecmem::io::details
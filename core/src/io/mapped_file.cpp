@@ -0,0 +1,134 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/io/mapped_file.hpp"
+
+// POSIX include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// System include(s).
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace vecmem::io {
+
+   mapped_file::mapped_file( const std::string& path )
+   : m_data( nullptr ), m_size( 0 ) {
+
+      // Open the file.
+      const int fd = ::open( path.c_str(), O_RDONLY );
+      if( fd < 0 ) {
+         throw std::runtime_error( "Failed to open file \"" + path + "\": " +
+                                   std::strerror( errno ) );
+      }
+
+      // Map it into memory.
+      struct stat info;
+      if( ::fstat( fd, &info ) != 0 ) {
+         ::close( fd );
+         throw std::runtime_error( "Failed to query file \"" + path + "\": " +
+                                   std::strerror( errno ) );
+      }
+      m_size = static_cast< std::size_t >( info.st_size );
+      if( m_size < sizeof( binary_header ) ) {
+         ::close( fd );
+         throw std::runtime_error( "File \"" + path + "\" is too small to be a "
+                                   "vecmem binary file" );
+      }
+      m_data = ::mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+      ::close( fd );
+      if( m_data == MAP_FAILED ) {
+         m_data = nullptr;
+         throw std::runtime_error( "Failed to map file \"" + path + "\": " +
+                                   std::strerror( errno ) );
+      }
+   }
+
+   mapped_file::mapped_file( mapped_file&& parent )
+   : m_data( parent.m_data ), m_size( parent.m_size ) {
+
+      parent.m_data = nullptr;
+      parent.m_size = 0;
+   }
+
+   mapped_file::~mapped_file() {
+
+      if( m_data != nullptr ) {
+         ::munmap( m_data, m_size );
+      }
+   }
+
+   mapped_file& mapped_file::operator=( mapped_file&& rhs ) {
+
+      // Avoid self-assignment.
+      if( this == &rhs ) {
+         return *this;
+      }
+
+      // Release the current mapping, and take over the other one.
+      if( m_data != nullptr ) {
+         ::munmap( m_data, m_size );
+      }
+      m_data = std::exchange( rhs.m_data, nullptr );
+      m_size = std::exchange( rhs.m_size, 0 );
+
+      // Return this object.
+      return *this;
+   }
+
+   const binary_header& mapped_file::header() const {
+
+      return *( static_cast< const binary_header* >( m_data ) );
+   }
+
+   const void* mapped_file::data() const {
+
+      return m_data;
+   }
+
+   std::size_t mapped_file::size() const {
+
+      return m_size;
+   }
+
+   const void* mapped_file::payload( binary_content content,
+                                     std::size_t element_size ) const {
+
+      // Check that the file holds what the user expects it to.
+      details::check_binary_header( header(), content, element_size );
+      const std::size_t offset = details::binary_payload_offset( header() );
+      if( ( offset > m_size ) ||
+          ( ( element_size != 0 ) &&
+            ( header().m_elements > ( m_size - offset ) / element_size ) ) ) {
+         throw std::runtime_error( "Truncated vecmem binary file" );
+      }
+
+      // Return the pointer to the payload.
+      return static_cast< const char* >( m_data ) + offset;
+   }
+
+   const std::uint64_t* mapped_file::offsets() const {
+
+      // Make sure that the offsets are inside of the mapped memory.
+      const std::size_t available =
+         ( m_size < sizeof( binary_header ) ? 0 :
+           ( m_size - sizeof( binary_header ) ) / sizeof( std::uint64_t ) );
+      if( header().m_rows >= available ) {
+         throw std::runtime_error( "Truncated vecmem binary file" );
+      }
+
+      return reinterpret_cast< const std::uint64_t* >(
+         static_cast< const char* >( m_data ) + sizeof( binary_header ) );
+   }
+
+} // namespace vecmem::io
@@ -47,6 +47,25 @@ namespace vecmem {
         }
     }
 
+    std::size_t binary_page_memory_resource::trim() {
+        std::size_t result = 0;
+
+        /*
+         * Deallocate the root pages that are entirely free, and remove them
+         * from our list.
+         */
+        auto unused = std::stable_partition(
+            m_pages.begin(), m_pages.end(),
+            [](const std::unique_ptr<page> & p) { return !p->is_free(); });
+        for (auto it = unused; it != m_pages.end(); ++it) {
+            m_upstream.deallocate((*it)->addr, (*it)->size);
+            result += (*it)->size;
+        }
+        m_pages.erase(unused, m_pages.end());
+
+        return result;
+    }
+
     void * binary_page_memory_resource::do_allocate(
         std::size_t size,
         std::size_t
@@ -0,0 +1,188 @@
+/**
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include "vecmem/memory/debug_memory_resource.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+namespace {
+    /**
+     * @brief Bookkeeping stored right in front of blocks with guard pages.
+     */
+    struct guard_header {
+        /// The block received from the upstream resource.
+        void * m_raw;
+        /// The size of the block received from the upstream resource.
+        std::size_t m_raw_size;
+        /// The inaccessible page, or null if there is none.
+        void * m_guard;
+    };
+
+    /// Get the page size of the system.
+    std::size_t page_size() {
+        static const std::size_t result =
+            static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        return result;
+    }
+
+    /// Round a value up to a multiple of a power of two.
+    std::uintptr_t round_up(std::uintptr_t value, std::size_t multiple) {
+        return (value + multiple - 1) & ~(std::uintptr_t(multiple) - 1);
+    }
+
+    /// Round a value down to a multiple of a power of two.
+    std::uintptr_t round_down(std::uintptr_t value, std::size_t multiple) {
+        return value & ~(std::uintptr_t(multiple) - 1);
+    }
+
+    /// Get the size of the canary area in front of a small block.
+    std::size_t front_size(std::size_t alignment) {
+        return (alignment > vecmem::debug_memory_resource::canary_size ?
+                alignment : vecmem::debug_memory_resource::canary_size);
+    }
+
+    /// Check that a memory area holds the canary pattern.
+    bool intact(const void * p, std::size_t size) {
+        const unsigned char * c = static_cast<const unsigned char *>(p);
+        for (std::size_t i = 0; i < size; ++i) {
+            if (c[i] != vecmem::debug_memory_resource::canary_pattern) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+namespace vecmem {
+    debug_memory_resource::debug_memory_resource(
+        memory_resource & upstream,
+        std::size_t guard_threshold,
+        bool abort_on_corruption
+    ) :
+        m_upstream(upstream),
+        m_guard_threshold(guard_threshold),
+        m_abort_on_corruption(abort_on_corruption),
+        m_corruptions(0)
+    {
+    }
+
+    std::size_t debug_memory_resource::corruptions() const {
+        return m_corruptions.load();
+    }
+
+    void * debug_memory_resource::do_allocate(
+        std::size_t size,
+        std::size_t alignment
+    ) {
+        if (!guarded(size)) {
+            /*
+             * Surround the block with canaries. The front area is a multiple
+             * of the alignment, so the block itself stays aligned.
+             */
+            const std::size_t front = ::front_size(alignment);
+            char * raw = static_cast<char *>(
+                m_upstream.allocate(front + size + canary_size, alignment));
+            std::memset(raw, canary_pattern, front);
+            std::memset(raw + front + size, canary_pattern, canary_size);
+            return raw + front;
+        }
+
+        /*
+         * Place the block so that it would end right in front of a page
+         * boundary, with the page after it made inaccessible. The header goes
+         * right in front of the block.
+         */
+        const std::size_t page = ::page_size();
+        const std::size_t data_pages =
+            ::round_up(size + alignment + sizeof(guard_header) +
+                       alignof(guard_header), page);
+        const std::size_t raw_size = page + data_pages + page;
+        void * raw = m_upstream.allocate(raw_size, alignof(std::max_align_t));
+
+        const std::uintptr_t guard =
+            ::round_up(reinterpret_cast<std::uintptr_t>(raw), page) +
+            data_pages;
+        const std::uintptr_t block = ::round_down(guard - size, alignment);
+        guard_header * header = reinterpret_cast<guard_header *>(
+            ::round_down(block - sizeof(guard_header),
+                         alignof(guard_header)));
+        header->m_raw = raw;
+        header->m_raw_size = raw_size;
+        header->m_guard = reinterpret_cast<void *>(guard);
+        if (mprotect(header->m_guard, page, PROT_NONE) != 0) {
+            header->m_guard = nullptr;
+        }
+        return reinterpret_cast<void *>(block);
+    }
+
+    void debug_memory_resource::do_deallocate(
+        void * p,
+        std::size_t size,
+        std::size_t alignment
+    ) {
+        if (!guarded(size)) {
+            /*
+             * Check the canaries, fill the block, and give it back.
+             */
+            const std::size_t front = ::front_size(alignment);
+            char * raw = static_cast<char *>(p) - front;
+            if (!::intact(raw, front) ||
+                !::intact(static_cast<char *>(p) + size, canary_size)) {
+                report(p, size);
+            }
+            std::memset(p, freed_pattern, size);
+            m_upstream.deallocate(raw, front + size + canary_size, alignment);
+            return;
+        }
+
+        /*
+         * Make the guard page accessible again, fill the block, and give the
+         * memory back.
+         */
+        const guard_header header = *reinterpret_cast<const guard_header *>(
+            ::round_down(reinterpret_cast<std::uintptr_t>(p) -
+                         sizeof(guard_header), alignof(guard_header)));
+        if (header.m_guard != nullptr) {
+            mprotect(header.m_guard, ::page_size(), PROT_READ | PROT_WRITE);
+        }
+        std::memset(p, freed_pattern, size);
+        m_upstream.deallocate(header.m_raw, header.m_raw_size,
+                              alignof(std::max_align_t));
+    }
+
+    bool debug_memory_resource::do_is_equal(
+        const memory_resource & other
+    ) const noexcept {
+        /*
+         * These memory resources are equal if and only if they are the same
+         * object.
+         */
+        return this == &other;
+    }
+
+    bool debug_memory_resource::guarded(std::size_t size) const {
+        return (m_guard_threshold != 0) && (size >= m_guard_threshold);
+    }
+
+    void debug_memory_resource::report(const void * p, std::size_t size) {
+        ++m_corruptions;
+        std::cerr << "vecmem::debug_memory_resource: Memory block at " << p
+                  << " of " << size << " bytes was written out of bounds"
+                  << std::endl;
+        if (m_abort_on_corruption) {
+            std::abort();
+        }
+    }
+}
@@ -9,22 +9,160 @@
 #include "vecmem/memory/memory_resource.hpp"
 #include "vecmem/memory/host_memory_resource.hpp"
 
+#include <cstddef>
+#include <cstdlib>
 #include <memory>
 
+/*
+ * The initial-exec TLS model uses the limited static TLS space of the process,
+ * which can make dlopen-ing the library (or a plugin linking it) fail. So it
+ * is only used when explicitly requested at build time.
+ */
+#if defined(VECMEM_HOST_CACHE_INITIAL_EXEC_TLS) && defined(__GNUC__) && \
+    !defined(_WIN32)
+#   define VECMEM_INITIAL_EXEC_TLS __attribute__((tls_model("initial-exec")))
+#else
+#   define VECMEM_INITIAL_EXEC_TLS
+#endif
+
+namespace {
+    /*
+     * The cached size classes are the powers of two from 2^min_class_bits up
+     * to 2^max_class_bits bytes. Each class has a magazine of at most
+     * magazine_size freed blocks.
+     */
+    constexpr std::size_t min_class_bits = 4;
+    constexpr std::size_t max_class_bits = 10;
+    constexpr std::size_t n_classes = max_class_bits - min_class_bits + 1;
+    constexpr std::size_t max_cached_size = std::size_t(1) << max_class_bits;
+    constexpr std::size_t magazine_size = 64;
+
+    /// Check whether an allocation is handled by the cache.
+    bool cacheable(std::size_t bytes, std::size_t alignment) {
+        return (bytes <= max_cached_size) &&
+               (alignment <= alignof(std::max_align_t));
+    }
+
+    /// Get the size class of a cacheable allocation.
+    std::size_t size_class(std::size_t bytes) {
+        if (bytes <= (std::size_t(1) << min_class_bits)) {
+            return 0;
+        }
+        std::size_t result = 0;
+        for (std::size_t v = (bytes - 1) >> min_class_bits; v != 0; v >>= 1) {
+            ++result;
+        }
+        return result;
+    }
+
+    /// Get the size of the blocks in a size class.
+    std::size_t class_size(std::size_t cls) {
+        return std::size_t(1) << (cls + min_class_bits);
+    }
+
+    /// Freed blocks of one size class.
+    struct magazine {
+        std::size_t m_count = 0;
+        void * m_blocks[magazine_size];
+    };
+
+    /// The freed blocks of one thread.
+    struct thread_cache {
+        magazine m_magazines[n_classes];
+    };
+
+    /*
+     * The per-thread state is kept in trivial variables. With the optional
+     * initial-exec TLS model accessing them from this shared library is as
+     * cheap as accessing any other thread-local variable. The cache itself
+     * is allocated on the heap, to keep the TLS usage of the library small.
+     */
+    VECMEM_INITIAL_EXEC_TLS thread_local thread_cache * cache = nullptr;
+    VECMEM_INITIAL_EXEC_TLS thread_local bool cache_destroyed = false;
+
+    /// Object freeing the cache of a thread, when the thread exits.
+    struct cache_cleanup {
+        ~cache_cleanup() {
+            for (magazine & m : cache->m_magazines) {
+                for (std::size_t i = 0; i < m.m_count; ++i) {
+                    std::free(m.m_blocks[i]);
+                }
+            }
+            delete cache;
+            cache = nullptr;
+            /*
+             * Blocks may still be freed during the destruction of static
+             * objects, after this point. Those need to go to free directly.
+             */
+            cache_destroyed = true;
+        }
+    };
+
+    /// Set up the cache of the current thread.
+    void create_cache() {
+        cache = new thread_cache();
+        static thread_local cache_cleanup cleanup;
+        (void)cleanup;
+    }
+}
+
 namespace vecmem {
+    host_memory_resource::host_memory_resource(bool use_cache)
+    : m_use_cache(use_cache) {
+    }
+
+    bool host_memory_resource::uses_cache() const {
+        return m_use_cache;
+    }
+
     void * host_memory_resource::do_allocate(
         std::size_t bytes,
-        std::size_t
+        std::size_t alignment
     ) {
-        return malloc(bytes);
+        if (!m_use_cache || !::cacheable(bytes, alignment)) {
+            return std::malloc(bytes);
+        }
+
+        /*
+         * Take a block from the magazine of the size class if possible, and
+         * allocate a block of the full class size otherwise. So that any
+         * block of the class could serve any request of the class later on.
+         */
+        const std::size_t cls = ::size_class(bytes);
+        if (::cache == nullptr) {
+            return std::malloc(::class_size(cls));
+        }
+        magazine & m = ::cache->m_magazines[cls];
+        if (m.m_count > 0) {
+            return m.m_blocks[--m.m_count];
+        }
+        return std::malloc(::class_size(cls));
     }
 
     void host_memory_resource::do_deallocate(
         void * p,
-        std::size_t,
-        std::size_t
+        std::size_t bytes,
+        std::size_t alignment
     ) {
-        free(p);
+        if (!m_use_cache || !::cacheable(bytes, alignment) ||
+            ::cache_destroyed || p == nullptr) {
+            std::free(p);
+            return;
+        }
+
+        /*
+         * Keep the block for later, unless the magazine of its size class is
+         * full already.
+         */
+        if (::cache == nullptr) {
+            ::create_cache();
+        }
+        magazine & m = ::cache->m_magazines[::size_class(bytes)];
+        if (m.m_count < magazine_size) {
+            m.m_blocks[m.m_count++] = p;
+            return;
+        }
+        std::free(p);
     }
 
     bool host_memory_resource::do_is_equal(
@@ -34,11 +172,12 @@ namespace vecmem {
          * All malloc resources are equal to each other, because they have no
          * internal state. Of course they have a shared underlying state in the
          * form of the underlying C library memory manager, but that is not
-         * relevant for us.
+         * relevant for us. As long as they agree on the use of the cache,
+         * which determines the size of the blocks really allocated.
          */
         const host_memory_resource * c;
         c = dynamic_cast<const host_memory_resource *>(&other);
 
-        return c != nullptr;
+        return (c != nullptr) && (c->m_use_cache == m_use_cache);
     }
 }
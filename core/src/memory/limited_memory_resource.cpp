@@ -0,0 +1,131 @@
+/**
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include "vecmem/memory/limited_memory_resource.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+
+namespace vecmem {
+    limited_memory_resource::limited_memory_resource(
+        memory_resource & upstream,
+        std::size_t hard_limit,
+        std::size_t soft_limit
+    ) :
+        m_upstream(upstream),
+        m_hard_limit(hard_limit),
+        m_soft_limit(soft_limit == 0 ? hard_limit :
+                     std::min(soft_limit, hard_limit)),
+        m_used(0)
+    {
+    }
+
+    void limited_memory_resource::add_callback(callback_type callback) {
+        std::lock_guard<std::mutex> lock(m_callbacks_mutex);
+        m_callbacks.push_back(std::move(callback));
+    }
+
+    std::size_t limited_memory_resource::used() const {
+        return m_used.load(std::memory_order_relaxed);
+    }
+
+    std::size_t limited_memory_resource::hard_limit() const {
+        return m_hard_limit;
+    }
+
+    std::size_t limited_memory_resource::soft_limit() const {
+        return m_soft_limit;
+    }
+
+    void * limited_memory_resource::do_allocate(
+        std::size_t size,
+        std::size_t alignment
+    ) {
+        /*
+         * Account for the allocation. If it doesn't fit, give the callbacks
+         * a chance to free up some memory, and try again.
+         */
+        std::size_t before = 0;
+        if (!reserve(size, before)) {
+            notify();
+            if (!reserve(size, before)) {
+                throw std::bad_alloc();
+            }
+        } else if (before <= m_soft_limit && before + size > m_soft_limit) {
+            /*
+             * If the allocation crossed the soft limit, let the callbacks
+             * know about it.
+             */
+            notify();
+        }
+
+        /*
+         * Perform the allocation, undoing the accounting if it fails.
+         */
+        try {
+            return m_upstream.allocate(size, alignment);
+        } catch (...) {
+            m_used.fetch_sub(size, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    void limited_memory_resource::do_deallocate(
+        void * p,
+        std::size_t size,
+        std::size_t alignment
+    ) {
+        m_upstream.deallocate(p, size, alignment);
+        m_used.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    bool limited_memory_resource::do_is_equal(
+        const memory_resource & other
+    ) const noexcept {
+        /*
+         * These memory resources are equal if and only if they are the same
+         * object.
+         */
+        return this == &other;
+    }
+
+    bool limited_memory_resource::reserve(
+        std::size_t size,
+        std::size_t & before
+    ) {
+        /*
+         * Only increase the memory use if the result stays within the hard
+         * limit, so that concurrent allocations would never see an
+         * over-committed state.
+         */
+        before = m_used.load(std::memory_order_relaxed);
+        do {
+            if (size > m_hard_limit || before > m_hard_limit - size) {
+                return false;
+            }
+        } while (!m_used.compare_exchange_weak(
+            before, before + size, std::memory_order_relaxed));
+        return true;
+    }
+
+    void limited_memory_resource::notify() {
+        /*
+         * Call the callbacks without holding the lock, so that they could
+         * deallocate memory, or register further callbacks.
+         */
+        std::vector<callback_type> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(m_callbacks_mutex);
+            callbacks = m_callbacks;
+        }
+        for (const callback_type & callback : callbacks) {
+            callback();
+        }
+    }
+}
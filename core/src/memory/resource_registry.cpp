@@ -0,0 +1,106 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/resource_registry.hpp"
+
+// System include(s).
+#include <stdexcept>
+#include <string>
+
+namespace vecmem {
+
+   resource_registry::resource_registry()
+   : m_resources(), m_mutex(), m_factories(), m_owned() {
+
+      for( std::atomic< memory_resource* >& resource : m_resources ) {
+         resource.store( nullptr, std::memory_order_relaxed );
+      }
+   }
+
+   resource_registry::~resource_registry() {
+
+      // Destroy the resources in the reverse order of their creation, as the
+      // later ones may be built on top of the earlier ones.
+      while( ! m_owned.empty() ) {
+         m_owned.pop_back();
+      }
+   }
+
+   resource_registry& resource_registry::instance() {
+
+      static resource_registry registry;
+      return registry;
+   }
+
+   void resource_registry::set_factory( memory_kind::kind_type kind,
+                                        factory_type factory ) {
+
+      std::lock_guard< std::mutex > lock( m_mutex );
+      m_factories.at( kind ) = std::move( factory );
+   }
+
+   memory_resource& resource_registry::get( int device,
+                                            memory_kind::kind_type kind ) {
+
+      // Check the device identifier.
+      if( ( device < 0 ) || ( device >= max_devices ) ) {
+         throw std::out_of_range( "Device identifier " +
+                                  std::to_string( device ) +
+                                  " is out of range" );
+      }
+
+      // Return the resource if it exists already.
+      memory_resource* result =
+         m_resources.at( device * n_kinds + kind ).load(
+            std::memory_order_acquire );
+      if( result != nullptr ) {
+         return *result;
+      }
+
+      // If not, create it.
+      return create( device, kind );
+   }
+
+   memory_resource& resource_registry::create( int device,
+                                               memory_kind::kind_type kind ) {
+
+      // Take a copy of the factory. It is called without holding the lock,
+      // so that it could take other resources from the registry itself.
+      factory_type factory;
+      {
+         std::lock_guard< std::mutex > lock( m_mutex );
+         factory = m_factories.at( kind );
+      }
+      if( ! factory ) {
+         throw std::runtime_error( "No factory set for memory kind " +
+                                   std::to_string( kind ) );
+      }
+
+      // Create the resource.
+      std::unique_ptr< memory_resource > resource = factory( device );
+      if( ! resource ) {
+         throw std::runtime_error( "Factory failed to create a resource for "
+                                   "memory kind " + std::to_string( kind ) );
+      }
+
+      // Publish it, unless another thread created the resource in the
+      // meantime. In which case the newly created one is discarded.
+      std::lock_guard< std::mutex > lock( m_mutex );
+      std::atomic< memory_resource* >& slot =
+         m_resources.at( device * n_kinds + kind );
+      memory_resource* result = slot.load( std::memory_order_relaxed );
+      if( result != nullptr ) {
+         return *result;
+      }
+      result = resource.get();
+      m_owned.push_back( std::move( resource ) );
+      slot.store( result, std::memory_order_release );
+      return *result;
+   }
+
+} // namespace vecmem
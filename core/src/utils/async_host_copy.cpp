@@ -0,0 +1,122 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/async_host_copy.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+
+namespace {
+
+   /// State shared between the copy tasks and the event of one copy
+   struct copy_state {
+      /// Mutex protecting the state
+      std::mutex m_mutex;
+      /// Condition variable signaling that all chunks have been copied
+      std::condition_variable m_condition;
+      /// The number of chunks that still need to be copied
+      std::size_t m_remaining;
+   }; // struct copy_state
+
+   /// Event type used by @c vecmem::async_host_copy
+   class host_event : public vecmem::abstract_event {
+
+   public:
+      /// Constructor with the state of the copy
+      host_event( std::shared_ptr< copy_state > state )
+      : m_state( std::move( state ) ) {}
+
+      /// Wait for all chunks of the copy to finish
+      virtual void wait() override {
+         std::unique_lock< std::mutex > lock( m_state->m_mutex );
+         m_state->m_condition.wait( lock, [ this ]() {
+            return ( m_state->m_remaining == 0 );
+         } );
+      }
+      /// Check if all chunks of the copy have finished
+      virtual bool ready() const override {
+         std::lock_guard< std::mutex > lock( m_state->m_mutex );
+         return ( m_state->m_remaining == 0 );
+      }
+
+   private:
+      /// The shared state of the copy
+      std::shared_ptr< copy_state > m_state;
+
+   }; // class host_event
+
+} // private namespace
+
+namespace vecmem {
+
+   async_host_copy::async_host_copy( std::size_t chunk_size )
+   : m_own_pool( std::make_unique< thread_pool >() ), m_pool( *m_own_pool ),
+     m_chunk_size( std::max< std::size_t >( chunk_size, 1 ) ) {
+
+   }
+
+   async_host_copy::async_host_copy( thread_pool& pool,
+                                     std::size_t chunk_size )
+   : m_own_pool(), m_pool( pool ),
+     m_chunk_size( std::max< std::size_t >( chunk_size, 1 ) ) {
+
+   }
+
+   async_host_copy::~async_host_copy() {
+
+   }
+
+   std::size_t async_host_copy::chunk_size() const {
+
+      return m_chunk_size;
+   }
+
+   void async_host_copy::do_copy( std::size_t size, const void* from,
+                                  void* to, type::copy_type cptype ) {
+
+      // Small copies are not worth handing over to the thread pool.
+      if( size <= m_chunk_size ) {
+         copy::do_copy( size, from, to, cptype );
+         return;
+      }
+      // Larger ones are executed in parallel, waiting for them to finish.
+      do_copy_async( size, from, to, cptype )->wait();
+   }
+
+   copy::event_type
+   async_host_copy::do_copy_async( std::size_t size, const void* from,
+                                   void* to, type::copy_type ) {
+
+      // Set up the shared state of the copy.
+      const std::size_t chunks = ( size + m_chunk_size - 1 ) / m_chunk_size;
+      auto state = std::make_shared< ::copy_state >();
+      state->m_remaining = chunks;
+
+      // Submit one task per chunk.
+      for( std::size_t i = 0; i < chunks; ++i ) {
+         const std::size_t offset = i * m_chunk_size;
+         const std::size_t bytes = std::min( m_chunk_size, size - offset );
+         const char* chunk_from = static_cast< const char* >( from ) + offset;
+         char* chunk_to = static_cast< char* >( to ) + offset;
+         m_pool.submit( [ state, chunk_from, chunk_to, bytes ]() {
+            std::memcpy( chunk_to, chunk_from, bytes );
+            std::lock_guard< std::mutex > lock( state->m_mutex );
+            if( --( state->m_remaining ) == 0 ) {
+               state->m_condition.notify_all();
+            }
+         } );
+      }
+
+      // Return an event for the copy.
+      return std::make_unique< ::host_event >( std::move( state ) );
+   }
+
+} // namespace vecmem
@@ -0,0 +1,111 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/memory/deallocator.hpp"
+
+// System include(s).
+#include <cstring>
+#include <memory>
+
+namespace {
+
+   /// Event type for operations that finished by the time it was created
+   class ready_event : public vecmem::abstract_event {
+
+   public:
+      /// There is nothing to wait for
+      virtual void wait() override {}
+      /// The operation is always finished
+      virtual bool ready() const override { return true; }
+
+   }; // class ready_event
+
+   /// Allocate a scratch memory block for a batched copy
+   std::unique_ptr< char, vecmem::details::deallocator >
+   allocate_scratch( std::size_t bytes, vecmem::memory_resource& resource ) {
+
+      return { static_cast< char* >( resource.allocate( bytes ) ),
+               { bytes, resource } };
+   }
+
+} // private namespace
+
+namespace vecmem {
+
+   copy::~copy() {
+
+   }
+
+   void copy::operator()( const copy_batch& batch,
+                          memory_resource& from_scratch,
+                          memory_resource& to_scratch,
+                          type::copy_type cptype ) {
+
+      // Perform the large copies directly.
+      for( const copy_batch::segment& s : batch.direct() ) {
+         do_copy( s.m_size, s.m_from, s.m_to, cptype );
+      }
+
+      // Host-to-host copies gain nothing from packing.
+      if( cptype == type::host_to_host ) {
+         for( const copy_batch::segment& s : batch.packed() ) {
+            do_copy( s.m_size, s.m_from, s.m_to, cptype );
+         }
+         return;
+      }
+
+      // Gather, transfer and scatter the small copies.
+      if( batch.packed_size() == 0 ) {
+         return;
+      }
+      auto from = ::allocate_scratch( batch.packed_size(), from_scratch );
+      auto to = ::allocate_scratch( batch.packed_size(), to_scratch );
+      do_gather( batch, from.get(), cptype );
+      do_copy( batch.packed_size(), from.get(), to.get(), cptype );
+      do_scatter( batch, to.get(), cptype );
+   }
+
+   void copy::do_copy( std::size_t size, const void* from, void* to,
+                       type::copy_type ) {
+
+      // Don't do anything for empty copies.
+      if( size == 0 ) {
+         return;
+      }
+      // Perform a simple copy.
+      std::memcpy( to, from, size );
+   }
+
+   copy::event_type copy::do_copy_async( std::size_t size, const void* from,
+                                         void* to, type::copy_type cptype ) {
+
+      // Perform the copy synchronously, and return a "finished" event.
+      do_copy( size, from, to, cptype );
+      return std::make_unique< ::ready_event >();
+   }
+
+   void copy::do_gather( const copy_batch& batch, void* packed,
+                         type::copy_type ) {
+
+      char* target = static_cast< char* >( packed );
+      for( const copy_batch::segment& s : batch.packed() ) {
+         std::memcpy( target + s.m_offset, s.m_from, s.m_size );
+      }
+   }
+
+   void copy::do_scatter( const copy_batch& batch, const void* packed,
+                          type::copy_type ) {
+
+      const char* source = static_cast< const char* >( packed );
+      for( const copy_batch::segment& s : batch.packed() ) {
+         std::memcpy( s.m_to, source + s.m_offset, s.m_size );
+      }
+   }
+
+} // namespace vecmem
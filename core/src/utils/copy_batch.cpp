@@ -0,0 +1,72 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/copy_batch.hpp"
+
+namespace vecmem {
+
+   copy_batch::copy_batch( std::size_t packing_limit )
+   : m_packing_limit( packing_limit ), m_packed(), m_packed_size( 0 ),
+     m_direct() {
+
+   }
+
+   void copy_batch::add( std::size_t size, const void* from, void* to ) {
+
+      // Ignore empty copies.
+      if( size == 0 ) {
+         return;
+      }
+
+      // Large copies are done directly.
+      if( size > m_packing_limit ) {
+         m_direct.push_back( { size, from, to, 0 } );
+         return;
+      }
+
+      // Small copies get an aligned place in the packed memory block.
+      const std::size_t offset =
+         ( ( m_packed_size + packing_alignment - 1 ) / packing_alignment ) *
+         packing_alignment;
+      m_packed.push_back( { size, from, to, offset } );
+      m_packed_size = offset + size;
+   }
+
+   std::size_t copy_batch::packing_limit() const {
+
+      return m_packing_limit;
+   }
+
+   const std::vector< copy_batch::segment >& copy_batch::packed() const {
+
+      return m_packed;
+   }
+
+   std::size_t copy_batch::packed_size() const {
+
+      return m_packed_size;
+   }
+
+   const std::vector< copy_batch::segment >& copy_batch::direct() const {
+
+      return m_direct;
+   }
+
+   bool copy_batch::empty() const {
+
+      return ( m_packed.empty() && m_direct.empty() );
+   }
+
+   void copy_batch::clear() {
+
+      m_packed.clear();
+      m_packed_size = 0;
+      m_direct.clear();
+   }
+
+} // namespace vecmem
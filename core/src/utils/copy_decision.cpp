@@ -0,0 +1,97 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/copy_decision.hpp"
+
+namespace {
+
+   /// Check whether a memory kind is host memory (pageable or pinned)
+   bool is_host( vecmem::memory_kind::kind_type kind ) {
+
+      return ( ( kind == vecmem::memory_kind::host ) ||
+               ( kind == vecmem::memory_kind::pinned_host ) );
+   }
+
+} // private namespace
+
+namespace vecmem {
+
+   copy_decision decide_copy( std::size_t size,
+                              memory_kind::kind_type from_kind,
+                              const void* from,
+                              memory_kind::kind_type to_kind, const void* to,
+                              std::size_t staging_threshold ) {
+
+      // Nothing to do for empty copies.
+      if( size == 0 ) {
+         return { copy_decision::skip, copy::type::unknown };
+      }
+
+      // Copies of a memory block onto itself.
+      if( from == to ) {
+         // Migrate managed memory to where it is needed.
+         if( ( from_kind == memory_kind::managed ) &&
+             ( to_kind == memory_kind::device ) ) {
+            return { copy_decision::prefetch, copy::type::host_to_device };
+         }
+         if( ( from_kind == memory_kind::managed ) && ::is_host( to_kind ) ) {
+            return { copy_decision::prefetch, copy::type::device_to_host };
+         }
+         return { copy_decision::skip, copy::type::unknown };
+      }
+
+      // Copies between host memory blocks.
+      if( ::is_host( from_kind ) && ::is_host( to_kind ) ) {
+         return { copy_decision::host_copy, copy::type::host_to_host };
+      }
+
+      // Copies between host and device memory.
+      if( ::is_host( from_kind ) && ( to_kind == memory_kind::device ) ) {
+         if( ( from_kind == memory_kind::host ) &&
+             ( staging_threshold != 0 ) && ( size >= staging_threshold ) ) {
+            return { copy_decision::staged_copy,
+                     copy::type::host_to_device };
+         }
+         return { copy_decision::runtime_copy, copy::type::host_to_device };
+      }
+      if( ( from_kind == memory_kind::device ) && ::is_host( to_kind ) ) {
+         if( ( to_kind == memory_kind::host ) &&
+             ( staging_threshold != 0 ) && ( size >= staging_threshold ) ) {
+            return { copy_decision::staged_copy,
+                     copy::type::device_to_host };
+         }
+         return { copy_decision::runtime_copy, copy::type::device_to_host };
+      }
+      if( ( from_kind == memory_kind::device ) &&
+          ( to_kind == memory_kind::device ) ) {
+         return { copy_decision::runtime_copy,
+                  copy::type::device_to_device };
+      }
+
+      // Let the runtime figure out copies involving managed/shared memory,
+      // and memory of unknown kinds.
+      return { copy_decision::runtime_copy, copy::type::unknown };
+   }
+
+   void memory_kind_map::set( const memory_resource& resource,
+                              memory_kind::kind_type kind ) {
+
+      m_kinds[ &resource ] = kind;
+   }
+
+   memory_kind::kind_type
+   memory_kind_map::get( const memory_resource& resource ) const {
+
+      auto itr = m_kinds.find( &resource );
+      if( itr == m_kinds.end() ) {
+         return memory_kind::unknown;
+      }
+      return itr->second;
+   }
+
+} // namespace vecmem
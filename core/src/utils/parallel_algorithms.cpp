@@ -0,0 +1,116 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/parallel_algorithms.hpp"
+
+// System include(s).
+#include <cassert>
+#include <vector>
+
+namespace {
+
+   /// Calculate the sum of a range of sizes
+   ///
+   /// This is a simple reduction, which the compiler can vectorise.
+   ///
+   std::size_t sum_sizes( const std::size_t* sizes, std::size_t n ) {
+
+      std::size_t result = 0;
+      for( std::size_t i = 0; i < n; ++i ) {
+         result += sizes[ i ];
+      }
+      return result;
+   }
+
+   /// Calculate the exclusive prefix sum of a range of sizes
+   ///
+   /// The loop is unrolled by hand, so that only one addition per four
+   /// elements would be on the loop-carried dependency chain.
+   ///
+   void scan_sizes( const std::size_t* sizes, std::size_t* offsets,
+                    std::size_t n, std::size_t carry ) {
+
+      std::size_t i = 0;
+      for( ; i + 4 <= n; i += 4 ) {
+         const std::size_t s0 = sizes[ i ];
+         const std::size_t s01 = s0 + sizes[ i + 1 ];
+         const std::size_t s012 = s01 + sizes[ i + 2 ];
+         const std::size_t s0123 = s012 + sizes[ i + 3 ];
+         offsets[ i ] = carry;
+         offsets[ i + 1 ] = carry + s0;
+         offsets[ i + 2 ] = carry + s01;
+         offsets[ i + 3 ] = carry + s012;
+         carry += s0123;
+      }
+      for( ; i < n; ++i ) {
+         const std::size_t size = sizes[ i ];
+         offsets[ i ] = carry;
+         carry += size;
+      }
+   }
+
+} // private namespace
+
+namespace vecmem::parallel {
+
+   namespace details {
+
+      thread_pool& default_thread_pool() {
+
+         static thread_pool pool;
+         return pool;
+      }
+
+   } // namespace details
+
+   std::size_t
+   make_offsets( const data::vector_view< const std::size_t >& sizes,
+                 const data::vector_view< std::size_t >& offsets,
+                 thread_pool& pool ) {
+
+      assert( sizes.m_size + 1 <= offsets.m_size );
+      const std::size_t size = sizes.m_size;
+      const std::size_t grain = details::grain_size( size, pool );
+      const std::size_t chunks = details::chunk_count( size, grain );
+      const std::size_t* in = sizes.m_ptr;
+      std::size_t* out = offsets.m_ptr;
+
+      // Sum up the sizes in every chunk but the last one, and calculate from
+      // those the offset that each chunk needs to start from.
+      std::vector< std::size_t > carries( chunks + 1, 0 );
+      if( chunks > 1 ) {
+         pool.parallel_for( ( chunks - 1 ) * grain,
+            [ in, grain, &carries ]( std::size_t begin, std::size_t end ) {
+               carries[ begin / grain + 1 ] =
+                  ::sum_sizes( in + begin, end - begin );
+            },
+            grain );
+         for( std::size_t i = 2; i < chunks; ++i ) {
+            carries[ i ] += carries[ i - 1 ];
+         }
+      }
+
+      // Calculate the offsets in every chunk. The total is only known once
+      // the last chunk was processed.
+      pool.parallel_for( size,
+         [ in, out, grain, chunks, &carries ]( std::size_t begin,
+                                               std::size_t end ) {
+            const std::size_t chunk = begin / grain;
+            const std::size_t last = in[ end - 1 ];
+            ::scan_sizes( in + begin, out + begin, end - begin,
+                          carries[ chunk ] );
+            if( chunk + 1 == chunks ) {
+               carries[ chunks ] = out[ end - 1 ] + last;
+            }
+         },
+         grain );
+      out[ size ] = carries[ chunks ];
+      return carries[ chunks ];
+   }
+
+} // namespace vecmem::parallel
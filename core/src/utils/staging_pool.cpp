@@ -0,0 +1,150 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/staging_pool.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+   /// Allocate the memory for all slots of a pool
+   std::unique_ptr< char, vecmem::details::deallocator >
+   allocate_slots( std::size_t bytes, vecmem::memory_resource& resource ) {
+
+      return { static_cast< char* >( resource.allocate( bytes ) ),
+               { bytes, resource } };
+   }
+
+   /// Wait for the transfers started on some slots, ignoring any errors
+   ///
+   /// Used while handling an error, to make sure that no transfer would be
+   /// using the slots or the user's memory anymore.
+   ///
+   void wait_quietly( vecmem::staging_pool::transfer& xfer,
+                      std::size_t slots ) {
+
+      for( std::size_t i = 0; i < slots; ++i ) {
+         try {
+            xfer.wait( i );
+         } catch( ... ) {
+         }
+      }
+   }
+
+} // private namespace
+
+namespace vecmem {
+
+   staging_pool::transfer::~transfer() {
+
+   }
+
+   staging_pool::staging_pool( memory_resource& resource,
+                               std::size_t slot_size, std::size_t slot_count )
+   : m_slot_size( std::max< std::size_t >( slot_size, 1 ) ),
+     m_slot_count( std::max< std::size_t >( slot_count, 1 ) ),
+     m_memory( ::allocate_slots( m_slot_size * m_slot_count, resource ) ),
+     m_mutex() {
+
+   }
+
+   std::size_t staging_pool::slot_size() const {
+
+      return m_slot_size;
+   }
+
+   std::size_t staging_pool::slot_count() const {
+
+      return m_slot_count;
+   }
+
+   void staging_pool::to_device( std::size_t size, const void* from,
+                                 void* to, transfer& xfer ) {
+
+      std::lock_guard< std::mutex > lock( m_mutex );
+      const char* source = static_cast< const char* >( from );
+      char* target = static_cast< char* >( to );
+
+      // Fill the slots one after the other, waiting for the previous
+      // transfer out of a slot before re-using it.
+      const std::size_t chunks = ( size + m_slot_size - 1 ) / m_slot_size;
+      std::size_t started = 0;
+      try {
+         for( std::size_t i = 0; i < chunks; ++i ) {
+            const std::size_t index = i % m_slot_count;
+            const std::size_t offset = i * m_slot_size;
+            const std::size_t bytes = std::min( m_slot_size, size - offset );
+            if( i >= m_slot_count ) {
+               xfer.wait( index );
+            }
+            std::memcpy( slot( index ), source + offset, bytes );
+            xfer.start( index, bytes, slot( index ), target + offset );
+            ++started;
+         }
+
+         // Wait for the last transfers to finish.
+         for( std::size_t i = 0; i < std::min( chunks, m_slot_count ); ++i ) {
+            xfer.wait( i );
+         }
+      } catch( ... ) {
+         // Don't leave transfers running after returning to the caller.
+         ::wait_quietly( xfer, std::min( started, m_slot_count ) );
+         throw;
+      }
+   }
+
+   void staging_pool::to_host( std::size_t size, const void* from, void* to,
+                               transfer& xfer ) {
+
+      std::lock_guard< std::mutex > lock( m_mutex );
+      const char* source = static_cast< const char* >( from );
+      char* target = static_cast< char* >( to );
+
+      // Helper lambda starting the transfer of a given chunk.
+      std::size_t started = 0;
+      auto start = [ & ]( std::size_t i ) {
+         const std::size_t offset = i * m_slot_size;
+         const std::size_t bytes = std::min( m_slot_size, size - offset );
+         xfer.start( i % m_slot_count, bytes, source + offset,
+                     slot( i % m_slot_count ) );
+         ++started;
+      };
+
+      const std::size_t chunks = ( size + m_slot_size - 1 ) / m_slot_size;
+      try {
+         // Start filling all of the slots.
+         for( std::size_t i = 0; i < std::min( chunks, m_slot_count ); ++i ) {
+            start( i );
+         }
+
+         // Empty the slots in order, refilling each one right away.
+         for( std::size_t i = 0; i < chunks; ++i ) {
+            const std::size_t index = i % m_slot_count;
+            const std::size_t offset = i * m_slot_size;
+            const std::size_t bytes = std::min( m_slot_size, size - offset );
+            xfer.wait( index );
+            std::memcpy( target + offset, slot( index ), bytes );
+            if( i + m_slot_count < chunks ) {
+               start( i + m_slot_count );
+            }
+         }
+      } catch( ... ) {
+         // Don't leave transfers running after returning to the caller.
+         ::wait_quietly( xfer, std::min( started, m_slot_count ) );
+         throw;
+      }
+   }
+
+   char* staging_pool::slot( std::size_t index ) {
+
+      return m_memory.get() + index * m_slot_size;
+   }
+
+} // namespace vecmem
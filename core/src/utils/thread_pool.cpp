@@ -0,0 +1,217 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace {
+
+   /// The pool that the current thread is a worker of (if any)
+   thread_local const vecmem::thread_pool* current_pool = nullptr;
+   /// The index of the current worker thread in its pool
+   thread_local std::size_t current_index = 0;
+
+   /// State shared between the threads executing a parallel loop
+   struct parallel_for_state {
+      /// The index of the next chunk to process
+      std::atomic< std::size_t > m_next{ 0 };
+      /// The number of chunks that were processed already
+      std::atomic< std::size_t > m_done{ 0 };
+      /// Mutex used for waiting on / recording the results
+      std::mutex m_mutex;
+      /// Condition variable signalling the end of the processing
+      std::condition_variable m_condition;
+      /// The first exception thrown by the processing
+      std::exception_ptr m_error;
+   };
+
+} // private namespace
+
+namespace vecmem {
+
+   thread_pool::thread_pool( std::size_t threads )
+   : m_pending( 0 ), m_next_queue( 0 ), m_stop( false ) {
+
+      // Decide how many threads to launch.
+      if( threads == 0 ) {
+         threads = std::thread::hardware_concurrency();
+      }
+      if( threads == 0 ) {
+         threads = 1;
+      }
+
+      // Set up the queues, and launch the worker threads.
+      m_queues.reserve( threads );
+      for( std::size_t i = 0; i < threads; ++i ) {
+         m_queues.push_back( std::make_unique< worker_queue >() );
+      }
+      m_threads.reserve( threads );
+      for( std::size_t i = 0; i < threads; ++i ) {
+         m_threads.emplace_back( [ this, i ]() { run( i ); } );
+      }
+   }
+
+   thread_pool::~thread_pool() {
+
+      // Tell the workers to stop, once they ran out of work.
+      {
+         std::lock_guard< std::mutex > lock( m_mutex );
+         m_stop = true;
+      }
+      m_condition.notify_all();
+
+      // Wait for all of them to finish.
+      for( std::thread& thread : m_threads ) {
+         thread.join();
+      }
+   }
+
+   std::size_t thread_pool::size() const {
+
+      return m_threads.size();
+   }
+
+   void thread_pool::submit( task_type task ) {
+
+      // Workers put new tasks into their own queue, everybody else
+      // distributes them among all the queues.
+      const std::size_t index =
+         ( ( ::current_pool == this ) ? ::current_index :
+           ( m_next_queue.fetch_add( 1 ) % m_queues.size() ) );
+
+      // Count the task before publishing it, so that a worker popping it
+      // right away would not make the counter wrap around.
+      {
+         std::lock_guard< std::mutex > lock( m_mutex );
+         ++m_pending;
+      }
+      {
+         worker_queue& queue = *( m_queues[ index ] );
+         std::lock_guard< std::mutex > lock( queue.m_mutex );
+         queue.m_tasks.push_back( std::move( task ) );
+      }
+
+      // Wake up one of the sleeping workers.
+      m_condition.notify_one();
+   }
+
+   void thread_pool::parallel_for( std::size_t size,
+                                   const range_task_type& task,
+                                   std::size_t grain ) {
+
+      // Decide how to split up the range.
+      if( size == 0 ) {
+         return;
+      }
+      if( grain == 0 ) {
+         grain = std::max< std::size_t >( size / ( 4 * m_queues.size() ), 1 );
+      }
+      const std::size_t chunks = ( size + grain - 1 ) / grain;
+
+      // Don't bother with the other threads for a single chunk.
+      if( chunks == 1 ) {
+         task( 0, size );
+         return;
+      }
+
+      // The function processing chunks until there are none left. Helper
+      // tasks that only start after all chunks were picked up return without
+      // touching the (by then possibly deleted) task object.
+      auto state = std::make_shared< ::parallel_for_state >();
+      auto work = [ state, &task, size, grain, chunks ]() {
+         for( std::size_t i = state->m_next.fetch_add( 1 ); i < chunks;
+              i = state->m_next.fetch_add( 1 ) ) {
+            try {
+               task( i * grain, std::min( size, ( i + 1 ) * grain ) );
+            } catch( ... ) {
+               std::lock_guard< std::mutex > lock( state->m_mutex );
+               if( ! state->m_error ) {
+                  state->m_error = std::current_exception();
+               }
+            }
+            if( state->m_done.fetch_add( 1 ) + 1 == chunks ) {
+               std::lock_guard< std::mutex > lock( state->m_mutex );
+               state->m_condition.notify_all();
+            }
+         }
+      };
+
+      // Let the worker threads help, while processing chunks on this thread
+      // as well.
+      const std::size_t helpers = std::min( chunks - 1, m_threads.size() );
+      for( std::size_t i = 0; i < helpers; ++i ) {
+         submit( work );
+      }
+      work();
+
+      // Wait for the chunks picked up by other threads to finish.
+      std::unique_lock< std::mutex > lock( state->m_mutex );
+      state->m_condition.wait( lock, [ &state, chunks ]() {
+         return ( state->m_done.load() == chunks );
+      } );
+      if( state->m_error ) {
+         std::rethrow_exception( state->m_error );
+      }
+   }
+
+   void thread_pool::run( std::size_t index ) {
+
+      // Remember which pool this thread belongs to.
+      ::current_pool = this;
+      ::current_index = index;
+
+      while( true ) {
+
+         // Try to find a task to execute.
+         task_type task;
+         if( try_pop( index, task ) ) {
+            task();
+            continue;
+         }
+
+         // If there was none, wait for new tasks to show up.
+         std::unique_lock< std::mutex > lock( m_mutex );
+         m_condition.wait( lock, [ this ]() {
+            return ( m_stop || ( m_pending.load() != 0 ) );
+         } );
+         // Only stop once all the tasks were executed.
+         if( m_pending.load() == 0 ) {
+            return;
+         }
+      }
+   }
+
+   bool thread_pool::try_pop( std::size_t index, task_type& task ) {
+
+      // Look at the thread's own queue first, and then at all the others.
+      for( std::size_t i = 0; i < m_queues.size(); ++i ) {
+         worker_queue& queue = *( m_queues[ ( index + i ) % m_queues.size() ] );
+         std::lock_guard< std::mutex > lock( queue.m_mutex );
+         if( queue.m_tasks.empty() ) {
+            continue;
+         }
+         // Execute the thread's own tasks in order, but steal tasks from the
+         // back of the other queues.
+         if( i == 0 ) {
+            task = std::move( queue.m_tasks.front() );
+            queue.m_tasks.pop_front();
+         } else {
+            task = std::move( queue.m_tasks.back() );
+            queue.m_tasks.pop_back();
+         }
+         --m_pending;
+         return true;
+      }
+      return false;
+   }
+
+} // namespace vecmem
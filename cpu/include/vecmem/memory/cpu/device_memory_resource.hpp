@@ -0,0 +1,65 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/memory/memory_resource.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::cpu {
+
+   /// Memory resource playing the role of "device memory" on the host
+   ///
+   /// Every allocation is mapped directly from the operating system, so the
+   /// "device" memory is kept separate from the host heap, just like it would
+   /// be with a real accelerator. Together with @c vecmem::cpu::copy and
+   /// @c vecmem::cpu::launch this allows code written for GPUs to be executed
+   /// (and tested) on hosts without any accelerators.
+   ///
+   /// When guard pages are requested, every allocation is surrounded by
+   /// inaccessible memory pages, with the allocated block placed right in
+   /// front of the trailing guard page. So any access beyond the end (or
+   /// before the beginning) of an allocation triggers a segmentation fault
+   /// right away, instead of silently corrupting other data.
+   ///
+   /// @note Like @c cudaMalloc, every allocation is an (expensive) system
+   ///       call. Use a caching resource on top of this one in
+   ///       performance critical code.
+   ///
+   class device_memory_resource : public memory_resource {
+
+   public:
+      /// Constructor, specifying whether to use guard pages
+      device_memory_resource( bool guard_pages = false );
+
+      /// Check whether the resource uses guard pages
+      bool guard_pages() const;
+
+   private:
+      /// @name Function(s) implementing @c vecmem::memory_resource
+      /// @{
+
+      /// Allocate a memory block, mapped from the operating system
+      virtual void* do_allocate( std::size_t size,
+                                 std::size_t alignment ) override;
+      /// Unmap a previously allocated memory block
+      virtual void do_deallocate( void* ptr, std::size_t size,
+                                  std::size_t alignment ) override;
+      /// Compare the equality of @c *this memory resource with another
+      virtual bool
+      do_is_equal( const memory_resource& other ) const noexcept override;
+
+      /// @}
+
+      /// Flag for using guard pages around the allocations
+      bool m_guard_pages;
+
+   }; // class device_memory_resource
+
+} // namespace vecmem::cpu
@@ -0,0 +1,42 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/async_host_copy.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::cpu {
+
+   /// Copy object for the memory of @c vecmem::cpu::device_memory_resource
+   ///
+   /// Since the "device" memory of the CPU backend is host accessible, all
+   /// copy directions are handled the same way. Large copies are split into
+   /// chunks that are executed in parallel by a @c vecmem::thread_pool, and
+   /// asynchronous copies are executed in the background by the same pool.
+   ///
+   class copy : public async_host_copy {
+
+   public:
+      /// Constructor with a chunk size, launching a private thread pool
+      copy( std::size_t chunk_size = default_chunk_size );
+      /// Constructor with an existing thread pool, and a chunk size
+      copy( thread_pool& pool, std::size_t chunk_size = default_chunk_size );
+      /// Destructor
+      ~copy();
+
+   protected:
+      /// Perform a memory copy, synchronously
+      virtual void do_copy( std::size_t size, const void* from, void* to,
+                            type::copy_type cptype ) override;
+
+   }; // class copy
+
+} // namespace vecmem::cpu
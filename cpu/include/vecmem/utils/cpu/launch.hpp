@@ -0,0 +1,49 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/parallel_algorithms.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::cpu {
+
+   /// Execute a "kernel" on the threads of a thread pool
+   ///
+   /// The kernel is called once for every index in [0, threads), with the
+   /// index as its first argument, followed by the additional arguments
+   /// given to this function. This is meant to mimic a 1-dimensional kernel
+   /// launch on a GPU, where every GPU thread would process the element
+   /// belonging to its global index. The indices are processed in
+   /// contiguous chunks, so that the kernel would access memory in a
+   /// cache friendly way.
+   ///
+   /// Unlike a GPU kernel launch, the function only returns once the kernel
+   /// was executed for all of the indices.
+   ///
+   /// @param pool The thread pool to execute the kernel on
+   /// @param threads The number of "GPU threads" to execute the kernel with
+   /// @param kernel The function to execute for every index
+   /// @param args The additional arguments to pass to the kernel
+   ///
+   /// @throws Whatever exception was thrown by @c kernel
+   ///
+   template< typename KERNEL, typename... ARGS >
+   void launch( thread_pool& pool, std::size_t threads, KERNEL kernel,
+                const ARGS&... args );
+
+   /// Execute a "kernel" on the threads of the default thread pool
+   template< typename KERNEL, typename... ARGS >
+   void launch( std::size_t threads, KERNEL kernel, const ARGS&... args );
+
+} // namespace vecmem::cpu
+
+// Include the implementation.
+#include "vecmem/utils/cpu/launch.ipp"
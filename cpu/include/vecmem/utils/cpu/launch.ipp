@@ -0,0 +1,35 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+namespace vecmem::cpu {
+
+   template< typename KERNEL, typename... ARGS >
+   void launch( thread_pool& pool, std::size_t threads, KERNEL kernel,
+                const ARGS&... args ) {
+
+      // Don't bother the thread pool with empty launches.
+      if( threads == 0 ) {
+         return;
+      }
+      // Let every chunk process its indices one by one.
+      pool.parallel_for( threads, [ &kernel, &args... ]( std::size_t begin,
+                                                         std::size_t end ) {
+         for( std::size_t i = begin; i < end; ++i ) {
+            kernel( i, args... );
+         }
+      } );
+   }
+
+   template< typename KERNEL, typename... ARGS >
+   void launch( std::size_t threads, KERNEL kernel, const ARGS&... args ) {
+
+      launch( parallel::details::default_thread_pool(), threads, kernel,
+              args... );
+   }
+
+} // namespace vecmem::cpu
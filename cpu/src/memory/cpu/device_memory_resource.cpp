@@ -0,0 +1,141 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/cpu/device_memory_resource.hpp"
+
+// System include(s).
+#include <new>
+
+// POSIX include(s).
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+   /// Get the size of the memory pages of the host
+   std::size_t page_size() {
+
+      static const std::size_t result =
+         static_cast< std::size_t >( ::sysconf( _SC_PAGESIZE ) );
+      return result;
+   }
+
+   /// Round a size up to a multiple of the page size
+   std::size_t round_to_pages( std::size_t size ) {
+
+      const std::size_t page = page_size();
+      return ( ( size + page - 1 ) / page ) * page;
+   }
+
+   /// Layout of a memory mapping with guard pages
+   struct guarded_layout {
+
+      /// Constructor, calculating the layout for one allocation
+      guarded_layout( std::size_t size, std::size_t alignment )
+      : m_payload( round_to_pages( size ) ),
+        m_total( m_payload + 2 * page_size() ),
+        // Place the block as close to the trailing guard page as the
+        // alignment allows.
+        m_offset( page_size() +
+                  ( ( m_payload - size ) & ~( alignment - 1 ) ) ) {}
+
+      /// The size of the accessible part of the mapping
+      std::size_t m_payload;
+      /// The total size of the mapping
+      std::size_t m_total;
+      /// The offset of the allocated block from the start of the mapping
+      std::size_t m_offset;
+
+   }; // struct guarded_layout
+
+} // private namespace
+
+namespace vecmem::cpu {
+
+   device_memory_resource::device_memory_resource( bool guard_pages )
+   : m_guard_pages( guard_pages ) {
+
+   }
+
+   bool device_memory_resource::guard_pages() const {
+
+      return m_guard_pages;
+   }
+
+   void* device_memory_resource::do_allocate( std::size_t size,
+                                              std::size_t alignment ) {
+
+      // Mappings are aligned to page boundaries, larger alignments can not be
+      // provided.
+      if( ( alignment == 0 ) || ( ( alignment & ( alignment - 1 ) ) != 0 ) ||
+          ( alignment > page_size() ) ) {
+         throw std::bad_alloc();
+      }
+      if( size == 0 ) {
+         size = 1;
+      }
+
+      // Without guard pages just map the requested memory.
+      if( m_guard_pages == false ) {
+         void* result = ::mmap( nullptr, round_to_pages( size ),
+                                PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+         if( result == MAP_FAILED ) {
+            throw std::bad_alloc();
+         }
+         return result;
+      }
+
+      // Map the full block as inaccessible, and then open up its payload.
+      const ::guarded_layout layout( size, alignment );
+      void* mapping = ::mmap( nullptr, layout.m_total, PROT_NONE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+      if( mapping == MAP_FAILED ) {
+         throw std::bad_alloc();
+      }
+      char* base = static_cast< char* >( mapping );
+      if( ::mprotect( base + page_size(), layout.m_payload,
+                      PROT_READ | PROT_WRITE ) != 0 ) {
+         ::munmap( mapping, layout.m_total );
+         throw std::bad_alloc();
+      }
+      return base + layout.m_offset;
+   }
+
+   void device_memory_resource::do_deallocate( void* ptr, std::size_t size,
+                                               std::size_t alignment ) {
+
+      if( ptr == nullptr ) {
+         return;
+      }
+      if( size == 0 ) {
+         size = 1;
+      }
+
+      // Release the mapping that the block was allocated from. Deallocation
+      // happens in destructors, so a failure is (silently) ignored, just like
+      // in the CUDA memory resources.
+      if( m_guard_pages == false ) {
+         ::munmap( ptr, round_to_pages( size ) );
+      } else {
+         const ::guarded_layout layout( size, alignment );
+         ::munmap( static_cast< char* >( ptr ) - layout.m_offset,
+                   layout.m_total );
+      }
+   }
+
+   bool device_memory_resource::do_is_equal(
+      const memory_resource& other ) const noexcept {
+
+      // The resources are interchangeable if they use the same memory layout.
+      const device_memory_resource* c =
+         dynamic_cast< const device_memory_resource* >( &other );
+      return ( ( c != nullptr ) && ( c->m_guard_pages == m_guard_pages ) );
+   }
+
+} // namespace vecmem::cpu
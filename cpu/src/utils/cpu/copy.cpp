@@ -0,0 +1,38 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/cpu/copy.hpp"
+
+namespace vecmem::cpu {
+
+   copy::copy( std::size_t chunk_size )
+   : async_host_copy( chunk_size ) {
+
+   }
+
+   copy::copy( thread_pool& pool, std::size_t chunk_size )
+   : async_host_copy( pool, chunk_size ) {
+
+   }
+
+   copy::~copy() {
+
+   }
+
+   void copy::do_copy( std::size_t size, const void* from, void* to,
+                       type::copy_type cptype ) {
+
+      // Copying a memory block onto itself is a no-op. (Which std::memcpy
+      // would not be allowed to do.)
+      if( from == to ) {
+         return;
+      }
+      async_host_copy::do_copy( size, from, to, cptype );
+   }
+
+} // namespace vecmem::cpu
@@ -0,0 +1,62 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/cuda/stream_wrapper.hpp"
+
+namespace vecmem::cuda {
+    /**
+     * @brief Memory resource allocating device memory in stream order.
+     *
+     * This memory resource uses @c cudaMallocAsync and @c cudaFreeAsync to
+     * allocate and deallocate device memory as operations on a CUDA stream.
+     * The allocations come from the memory pool of the device, so repeated
+     * allocations are much cheaper than with @c cudaMalloc, and they do not
+     * need to synchronise the device.
+     *
+     * @note The memory handed out by this resource may only be used by
+     * operations scheduled on the stream of the resource (or on streams
+     * synchronised with it). Deallocating a block only schedules its release
+     * on the stream, after all operations that were scheduled before it.
+     */
+    class async_device_memory_resource : public memory_resource {
+    public:
+        /**
+         * @brief Construct a stream ordered resource for a specific stream.
+         *
+         * @param stream The stream to order the allocations on. The resource
+         * keeps a copy of the wrapper, so a stream owned by the wrapper is
+         * kept alive for as long as the resource exists.
+         */
+        async_device_memory_resource(const stream_wrapper & stream);
+
+        /**
+         * @brief Get the stream that the allocations are ordered on.
+         */
+        const stream_wrapper & stream() const;
+    private:
+        virtual void * do_allocate(
+            std::size_t,
+            std::size_t
+        ) override;
+
+        virtual void do_deallocate(
+            void * p,
+            std::size_t,
+            std::size_t
+        ) override;
+
+        virtual bool do_is_equal(
+            const memory_resource &
+        ) const noexcept override;
+
+        const stream_wrapper m_stream;
+    };
+}
@@ -8,9 +8,18 @@
 #pragma once
 
 // Local include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/jagged_vector_view.hpp"
 #include "vecmem/containers/data/vector_buffer.hpp"
 #include "vecmem/containers/data/vector_view.hpp"
 #include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/copy_batch.hpp"
+#include "vecmem/utils/cuda/stream_wrapper.hpp"
+#include "vecmem/utils/staging_pool.hpp"
+
+// System include(s).
+#include <type_traits>
 
 namespace vecmem::cuda {
 
@@ -31,6 +40,107 @@ namespace vecmem::cuda {
    void copy( const vecmem::data::vector_view< TYPE >& from,
               vecmem::data::vector_view< TYPE >& to );
 
+   /// Function copying a jagged vector from the host to the device
+   ///
+   /// The data is packed into a single memory block on the host, and is then
+   /// transferred to the device with a single copy.
+   ///
+   template< typename TYPE >
+   vecmem::data::jagged_vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_device( const vecmem::data::jagged_vector_view< TYPE >& host,
+                   memory_resource& resource );
+
+   /// Function copying a jagged vector buffer from the device to the host
+   template< typename TYPE >
+   vecmem::data::jagged_vector_buffer< TYPE >
+   copy_to_host( const vecmem::data::jagged_vector_buffer< TYPE >& device,
+                 memory_resource& resource );
+
+   /// @name Stream ordered copy functions
+   ///
+   /// These functions only schedule the memory transfers on the specified
+   /// stream, and return right away. The source memory needs to stay valid,
+   /// and the results may only be used, once the stream was synchronised, or
+   /// from operations scheduled on the same stream. The host memory taking
+   /// part in the copies should be pinned (page-locked) for the transfers to
+   /// really be asynchronous with respect to the host.
+   ///
+   /// @{
+
+   /// Function copying a buffer from the host to the device, asynchronously
+   template< typename TYPE >
+   vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_device( const vecmem::data::vector_view< TYPE >& host,
+                   memory_resource& resource, const stream_wrapper& stream );
+
+   /// Function copying a buffer from the device to the host, asynchronously
+   template< typename TYPE >
+   vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_host( const vecmem::data::vector_view< TYPE >& device,
+                 memory_resource& resource, const stream_wrapper& stream );
+
+   /// Helper function for copying the contents of a 1-dimensional array,
+   /// asynchronously
+   template< typename TYPE >
+   void copy( const vecmem::data::vector_view< TYPE >& from,
+              vecmem::data::vector_view< TYPE >& to,
+              const stream_wrapper& stream );
+
+   /// @}
+
+   /// @name Staged copy functions
+   ///
+   /// These functions route the copies between pageable host memory and the
+   /// device through the pinned slots of a @c vecmem::staging_pool, with
+   /// the transfers of the individual chunks scheduled on the specified
+   /// stream. They return once the copy has finished.
+   ///
+   /// @{
+
+   /// Function copying a buffer from the host to the device, through a
+   /// staging pool
+   template< typename TYPE >
+   vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_device( const vecmem::data::vector_view< TYPE >& host,
+                   memory_resource& resource, staging_pool& staging,
+                   const stream_wrapper& stream );
+
+   /// Function copying a buffer from the device to the host, through a
+   /// staging pool
+   template< typename TYPE >
+   vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_host( const vecmem::data::vector_view< TYPE >& device,
+                 memory_resource& resource, staging_pool& staging,
+                 const stream_wrapper& stream );
+
+   /// @}
+
+   /// @name Batched copy functions
+   /// @{
+
+   /// Function performing all copies of a batch on a stream
+   ///
+   /// For host-to-device copies the small copies of the batch are gathered
+   /// on the host, transferred to the device with a single copy, and
+   /// scattered into their targets by a kernel. For device-to-host copies
+   /// they are gathered by a kernel, transferred with a single copy, and
+   /// scattered on the host. The large copies, and the copies in any other
+   /// direction, are performed one by one. The function returns once all
+   /// of the copies finished.
+   ///
+   /// @param batch The copies to perform
+   /// @param host_scratch Resource for the (pinned) host scratch memory
+   /// @param device_scratch Resource for the device scratch memory
+   /// @param cptype The direction of all of the copies
+   /// @param stream The stream to perform the copies on
+   ///
+   void copy( const copy_batch& batch, memory_resource& host_scratch,
+              memory_resource& device_scratch,
+              vecmem::copy::type::copy_type cptype,
+              const stream_wrapper& stream );
+
+   /// @}
+
 } // namespace vecmem::cuda
 
 // Include the implementation.
@@ -9,6 +9,7 @@
 
 // System include(s).
 #include <cstddef>
+#include <memory>
 
 namespace vecmem::cuda {
 
@@ -23,6 +24,25 @@ namespace vecmem::cuda {
       /// Helper function performing an unspecified type of copy
       void copy( std::size_t size, const void* from, void* to );
 
+      /// Helper function scheduling an H->D copy on a stream
+      void copy_to_device( std::size_t size, const void* hostPtr,
+                           void* devicePtr, const stream_wrapper& stream );
+      /// Helper function scheduling a D->H copy on a stream
+      void copy_to_host( std::size_t size, const void* devicePtr,
+                         void* hostPtr, const stream_wrapper& stream );
+      /// Helper function scheduling an unspecified type of copy on a stream
+      void copy( std::size_t size, const void* from, void* to,
+                 const stream_wrapper& stream );
+
+      /// Helper function performing an H->D copy through a staging pool
+      void copy_to_device( std::size_t size, const void* hostPtr,
+                           void* devicePtr, staging_pool& staging,
+                           const stream_wrapper& stream );
+      /// Helper function performing a D->H copy through a staging pool
+      void copy_to_host( std::size_t size, const void* devicePtr,
+                         void* hostPtr, staging_pool& staging,
+                         const stream_wrapper& stream );
+
    } // namespace details
 
    template< typename TYPE >
@@ -54,4 +74,106 @@ namespace vecmem::cuda {
       details::copy( from.m_size * sizeof( TYPE ), from.m_ptr, to.m_ptr );
    }
 
+   template< typename TYPE >
+   vecmem::data::jagged_vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_device( const vecmem::data::jagged_vector_view< TYPE >& host,
+                   memory_resource& resource ) {
+
+      // Pack the jagged vector in host memory.
+      const vecmem::details::jagged_vector_layout layout =
+         vecmem::details::make_jagged_vector_layout( host );
+      vecmem::data::jagged_vector_buffer< std::remove_cv_t< TYPE > >
+         device( layout.m_rows, layout.m_elements, resource );
+      if( layout.m_total_bytes == 0 ) {
+         return device;
+      }
+      std::unique_ptr< char[] > staging( new char[ layout.m_total_bytes ] );
+      vecmem::details::pack_jagged_vector( host, layout, staging.get(),
+                                           device.memory() );
+
+      // Transfer it to the device in one go.
+      details::copy_to_device( layout.m_total_bytes, staging.get(),
+                               device.memory() );
+      return device;
+   }
+
+   template< typename TYPE >
+   vecmem::data::jagged_vector_buffer< TYPE >
+   copy_to_host( const vecmem::data::jagged_vector_buffer< TYPE >& device,
+                 memory_resource& resource ) {
+
+      // Transfer the entire memory block to the host in one go.
+      vecmem::data::jagged_vector_buffer< TYPE >
+         host( device.layout().m_rows, device.layout().m_elements, resource );
+      if( device.layout().m_total_bytes == 0 ) {
+         return host;
+      }
+      details::copy_to_host( device.layout().m_total_bytes, device.memory(),
+                             host.memory() );
+
+      // Make the views point to the host memory.
+      vecmem::details::rebase_jagged_vector( host.m_ptr, host.m_size,
+                                             device.memory(), host.memory() );
+      return host;
+   }
+
+   template< typename TYPE >
+   vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_device( const vecmem::data::vector_view< TYPE >& host,
+                   memory_resource& resource, const stream_wrapper& stream ) {
+
+      vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+         device( host.m_size, resource );
+      details::copy_to_device( host.m_size * sizeof( TYPE ), host.m_ptr,
+                               device.m_ptr, stream );
+      return device;
+   }
+
+   template< typename TYPE >
+   vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_host( const vecmem::data::vector_view< TYPE >& device,
+                 memory_resource& resource, const stream_wrapper& stream ) {
+
+      vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+         host( device.m_size, resource );
+      details::copy_to_host( device.m_size * sizeof( TYPE ), device.m_ptr,
+                             host.m_ptr, stream );
+      return host;
+   }
+
+   template< typename TYPE >
+   void copy( const vecmem::data::vector_view< TYPE >& from,
+              vecmem::data::vector_view< TYPE >& to,
+              const stream_wrapper& stream ) {
+
+      details::copy( from.m_size * sizeof( TYPE ), from.m_ptr, to.m_ptr,
+                     stream );
+   }
+
+   template< typename TYPE >
+   vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_device( const vecmem::data::vector_view< TYPE >& host,
+                   memory_resource& resource, staging_pool& staging,
+                   const stream_wrapper& stream ) {
+
+      vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+         device( host.m_size, resource );
+      details::copy_to_device( host.m_size * sizeof( TYPE ), host.m_ptr,
+                               device.m_ptr, staging, stream );
+      return device;
+   }
+
+   template< typename TYPE >
+   vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+   copy_to_host( const vecmem::data::vector_view< TYPE >& device,
+                 memory_resource& resource, staging_pool& staging,
+                 const stream_wrapper& stream ) {
+
+      vecmem::data::vector_buffer< std::remove_cv_t< TYPE > >
+         host( device.m_size, resource );
+      details::copy_to_host( device.m_size * sizeof( TYPE ), device.m_ptr,
+                             host.m_ptr, staging, stream );
+      return host;
+   }
+
 } // namespace vecmem::cuda
@@ -0,0 +1,87 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/utils/copy_decision.hpp"
+#include "vecmem/utils/cuda/stream_wrapper.hpp"
+#include "vecmem/utils/staging_pool.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::cuda {
+
+   /// Copy front-end choosing the transfer path based on the memory resources
+   ///
+   /// The object is told which memory resources the source and target views
+   /// were allocated with. From that it figures out the kinds of memory
+   /// taking part in the copy, and uses @c vecmem::decide_copy to skip the
+   /// unnecessary copies, to prefetch managed memory instead of copying it,
+   /// and to route the copies between pageable host and device memory
+   /// through a staging pool (if one was provided).
+   ///
+   /// The memory resources of @c vecmem::core and @c vecmem::cuda are
+   /// recognised automatically. The kind of memory provided by any other
+   /// resource (for instance a caching resource built on top of a CUDA
+   /// resource) needs to be set with @c set_kind, otherwise the copies
+   /// involving it are left to the CUDA runtime.
+   ///
+   /// All copies are performed on the stream of the object, and are
+   /// finished by the time the copy functions return.
+   ///
+   class resource_aware_copy {
+
+   public:
+      /// The default minimum size of the copies going through staging
+      static constexpr std::size_t default_staging_threshold = 1048576;
+
+      /// Constructor with a stream, and optionally a staging pool
+      resource_aware_copy( const stream_wrapper& stream,
+                           staging_pool* staging = nullptr,
+                           std::size_t staging_threshold =
+                              default_staging_threshold );
+
+      /// Set the kind of memory that a resource provides
+      void set_kind( const memory_resource& resource,
+                     memory_kind::kind_type kind );
+      /// Get the kind of memory that a resource provides
+      memory_kind::kind_type kind( const memory_resource& resource ) const;
+
+      /// Copy the contents of a 1-dimensional array
+      ///
+      /// @return The decision about how the copy was performed
+      ///
+      template< typename TYPE1, typename TYPE2 >
+      copy_decision operator()( const data::vector_view< TYPE1 >& from,
+                                const memory_resource& from_resource,
+                                const data::vector_view< TYPE2 >& to,
+                                const memory_resource& to_resource );
+
+   private:
+      /// Perform a "low level" memory copy
+      copy_decision do_copy( std::size_t size, const void* from,
+                             memory_kind::kind_type from_kind, void* to,
+                             memory_kind::kind_type to_kind );
+
+      /// The stream to perform the copies on
+      stream_wrapper m_stream;
+      /// The staging pool to use (if any)
+      staging_pool* m_staging;
+      /// The minimum size of the copies going through staging
+      std::size_t m_staging_threshold;
+      /// The kinds of memory set explicitly for some resources
+      memory_kind_map m_kinds;
+
+   }; // class resource_aware_copy
+
+} // namespace vecmem::cuda
+
+// Include the implementation.
+#include "vecmem/utils/cuda/resource_aware_copy.ipp"
@@ -0,0 +1,32 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cassert>
+#include <type_traits>
+
+namespace vecmem::cuda {
+
+   template< typename TYPE1, typename TYPE2 >
+   copy_decision
+   resource_aware_copy::operator()( const data::vector_view< TYPE1 >& from,
+                                    const memory_resource& from_resource,
+                                    const data::vector_view< TYPE2 >& to,
+                                    const memory_resource& to_resource ) {
+
+      // The types need to be compatible, and the target large enough.
+      static_assert( std::is_same< std::remove_cv_t< TYPE1 >,
+                                   std::remove_cv_t< TYPE2 > >::value,
+                     "Can only copy between views of the same type" );
+      assert( to.m_size >= from.m_size );
+
+      return do_copy( from.m_size * sizeof( TYPE1 ), from.m_ptr,
+                      kind( from_resource ), to.m_ptr, kind( to_resource ) );
+   }
+
+} // namespace vecmem::cuda
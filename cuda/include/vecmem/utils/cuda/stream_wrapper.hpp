@@ -0,0 +1,70 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <memory>
+
+namespace vecmem::cuda {
+
+   // Forward declaration(s).
+   namespace details {
+      class opaque_stream;
+   }
+
+   /// Wrapper class for @c cudaStream_t
+   ///
+   /// It is necessary for passing around CUDA stream objects in code that
+   /// should not be directly exposed to the CUDA headers.
+   ///
+   /// Copies of a wrapper that owns its stream share the ownership of that
+   /// stream, so the stream is only destroyed once the last wrapper pointing
+   /// at it goes away.
+   ///
+   class stream_wrapper {
+
+   public:
+      /// Construct a new stream for a specific device
+      ///
+      /// If the device number is negative, the stream is created for the
+      /// currently selected device.
+      ///
+      stream_wrapper( int device = -1 );
+      /// Wrap an existing @c cudaStream_t object
+      ///
+      /// Without taking ownership of it!
+      ///
+      stream_wrapper( void* stream );
+
+      /// Copy constructor
+      stream_wrapper( const stream_wrapper& parent );
+      /// Move constructor
+      stream_wrapper( stream_wrapper&& parent );
+
+      /// Destructor
+      ~stream_wrapper();
+
+      /// Copy assignment
+      stream_wrapper& operator=( const stream_wrapper& rhs );
+      /// Move assignment
+      stream_wrapper& operator=( stream_wrapper&& rhs );
+
+      /// Access a typeless pointer to the managed @c cudaStream_t object
+      void* stream() const;
+
+      /// Wait for all queued tasks from the stream to complete
+      void synchronize();
+
+   private:
+      /// Bare pointer to the wrapped @c cudaStream_t object
+      void* m_stream;
+      /// Smart pointer to the managed @c cudaStream_t object
+      std::shared_ptr< details::opaque_stream > m_managedStream;
+
+   }; // class stream_wrapper
+
+} // namespace vecmem::cuda
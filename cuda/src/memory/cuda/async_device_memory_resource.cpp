@@ -0,0 +1,64 @@
+/*
+ * VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include "../../utils/cuda_error_handling.hpp"
+#include "../../utils/cuda/get_stream.hpp"
+
+#include "vecmem/memory/memory_resource.hpp"
+#include "vecmem/memory/cuda/async_device_memory_resource.hpp"
+
+#include <cuda_runtime_api.h>
+
+namespace vecmem::cuda {
+    async_device_memory_resource::async_device_memory_resource(
+        const stream_wrapper & stream
+    ) :
+        m_stream(stream)
+    {
+    }
+
+    const stream_wrapper & async_device_memory_resource::stream() const {
+        return m_stream;
+    }
+
+    void * async_device_memory_resource::do_allocate(
+        std::size_t bytes,
+        std::size_t
+    ) {
+        /*
+         * The allocation is made on the device that the stream belongs to, so
+         * there is no need to select a device explicitly.
+         */
+        void * res;
+        VECMEM_CUDA_ERROR_CHECK(
+            cudaMallocAsync(&res, bytes, details::get_stream(m_stream)));
+        return res;
+    }
+
+    void async_device_memory_resource::do_deallocate(
+        void * p,
+        std::size_t,
+        std::size_t
+    ) {
+        VECMEM_CUDA_ERROR_CHECK(
+            cudaFreeAsync(p, details::get_stream(m_stream)));
+    }
+
+    bool async_device_memory_resource::do_is_equal(
+        const memory_resource & other
+    ) const noexcept {
+        const async_device_memory_resource * c;
+        c = dynamic_cast<const async_device_memory_resource *>(&other);
+
+        /*
+         * Memory can be freed through any resource ordered on the same
+         * stream.
+         */
+        return c != nullptr && c->m_stream.stream() == m_stream.stream();
+    }
+}
@@ -9,10 +9,86 @@
 // Local include(s).
 #include "vecmem/utils/cuda/copy.hpp"
 #include "../cuda_error_handling.hpp"
+#include "get_stream.hpp"
 
 // CUDA include(s).
 #include <cuda_runtime_api.h>
 
+// System include(s).
+#include <vector>
+
+namespace {
+
+   /// Transfer implementation for @c vecmem::staging_pool
+   ///
+   /// It schedules the transfers on a stream, and records an event after
+   /// every transfer to be able to wait for the individual slots.
+   ///
+   class staging_transfer : public vecmem::staging_pool::transfer {
+
+   public:
+      /// Constructor with the stream, the number of slots and the direction
+      staging_transfer( cudaStream_t stream, std::size_t slots,
+                        cudaMemcpyKind kind )
+      : m_stream( stream ), m_kind( kind ), m_events() {
+
+         m_events.reserve( slots );
+         try {
+            for( std::size_t i = 0; i < slots; ++i ) {
+               cudaEvent_t event = nullptr;
+               VECMEM_CUDA_ERROR_CHECK(
+                  cudaEventCreateWithFlags( &event, cudaEventDisableTiming ) );
+               m_events.push_back( event );
+            }
+         } catch( ... ) {
+            // The destructor is not called for a partially constructed
+            // object, so the events created so far need to be destroyed here.
+            destroy_events();
+            throw;
+         }
+      }
+      /// Destructor, destroying the events
+      ~staging_transfer() {
+
+         destroy_events();
+      }
+
+      /// Schedule a transfer, and record an event after it
+      virtual void start( std::size_t slot, std::size_t size,
+                          const void* from, void* to ) override {
+
+         VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync( to, from, size, m_kind,
+                                                   m_stream ) );
+         VECMEM_CUDA_ERROR_CHECK( cudaEventRecord( m_events[ slot ],
+                                                   m_stream ) );
+      }
+      /// Wait for the last transfer of a slot to finish
+      virtual void wait( std::size_t slot ) override {
+
+         VECMEM_CUDA_ERROR_CHECK( cudaEventSynchronize( m_events[ slot ] ) );
+      }
+
+   private:
+      /// Destroy all of the events created so far
+      void destroy_events() {
+
+         for( cudaEvent_t event : m_events ) {
+            VECMEM_CUDA_ERROR_IGNORE( cudaEventDestroy( event ) );
+         }
+         m_events.clear();
+      }
+
+      /// The stream to schedule the transfers on
+      cudaStream_t m_stream;
+      /// The direction of the transfers
+      cudaMemcpyKind m_kind;
+      /// Events marking the end of the last transfer of each slot
+      std::vector< cudaEvent_t > m_events;
+
+   }; // class staging_transfer
+
+} // private namespace
+
 namespace vecmem::cuda::details {
 
    void copy_to_device( std::size_t size, const void* hostPtr,
@@ -35,4 +111,46 @@ namespace vecmem::cuda::details {
                                            cudaMemcpyDefault ) );
    }
 
+   void copy_to_device( std::size_t size, const void* hostPtr,
+                        void* devicePtr, const stream_wrapper& stream ) {
+
+      VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync( devicePtr, hostPtr, size,
+                                                cudaMemcpyHostToDevice,
+                                                get_stream( stream ) ) );
+   }
+
+   void copy_to_host( std::size_t size, const void* devicePtr,
+                      void* hostPtr, const stream_wrapper& stream ) {
+
+      VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync( hostPtr, devicePtr, size,
+                                                cudaMemcpyDeviceToHost,
+                                                get_stream( stream ) ) );
+   }
+
+   void copy( std::size_t size, const void* from, void* to,
+              const stream_wrapper& stream ) {
+
+      VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync( to, from, size,
+                                                cudaMemcpyDefault,
+                                                get_stream( stream ) ) );
+   }
+
+   void copy_to_device( std::size_t size, const void* hostPtr,
+                        void* devicePtr, staging_pool& staging,
+                        const stream_wrapper& stream ) {
+
+      ::staging_transfer xfer( get_stream( stream ), staging.slot_count(),
+                               cudaMemcpyHostToDevice );
+      staging.to_device( size, hostPtr, devicePtr, xfer );
+   }
+
+   void copy_to_host( std::size_t size, const void* devicePtr,
+                      void* hostPtr, staging_pool& staging,
+                      const stream_wrapper& stream ) {
+
+      ::staging_transfer xfer( get_stream( stream ), staging.slot_count(),
+                               cudaMemcpyDeviceToHost );
+      staging.to_host( size, devicePtr, hostPtr, xfer );
+   }
+
 } // namespace vecmem::cuda::details
@@ -0,0 +1,110 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/cuda/copy.hpp"
+#include "vecmem/memory/deallocator.hpp"
+#include "../cuda_error_handling.hpp"
+#include "copy_batch_kernels.hpp"
+#include "get_stream.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <cstring>
+#include <memory>
+
+namespace {
+
+   /// Allocate a scratch memory block for a batched copy
+   std::unique_ptr< char, vecmem::details::deallocator >
+   allocate_scratch( std::size_t bytes, vecmem::memory_resource& resource ) {
+
+      return { static_cast< char* >( resource.allocate( bytes ) ),
+               { bytes, resource } };
+   }
+
+} // private namespace
+
+namespace vecmem::cuda {
+
+   void copy( const copy_batch& batch, memory_resource& host_scratch,
+              memory_resource& device_scratch,
+              vecmem::copy::type::copy_type cptype,
+              const stream_wrapper& stream ) {
+
+      cudaStream_t cuda_stream = details::get_stream( stream );
+
+      // Schedule the large copies directly.
+      for( const copy_batch::segment& s : batch.direct() ) {
+         VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync(
+            s.m_to, s.m_from, s.m_size, cudaMemcpyDefault, cuda_stream ) );
+      }
+
+      // Only host<->device copies are packed.
+      const std::vector< copy_batch::segment >& packed = batch.packed();
+      if( ( packed.empty() ) ||
+          ( ( cptype != vecmem::copy::type::host_to_device ) &&
+            ( cptype != vecmem::copy::type::device_to_host ) ) ) {
+         for( const copy_batch::segment& s : packed ) {
+            VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync(
+               s.m_to, s.m_from, s.m_size, cudaMemcpyDefault,
+               cuda_stream ) );
+         }
+         stream.synchronize();
+         return;
+      }
+
+      // The scratch memory blocks hold the segment descriptions, followed by
+      // the packed data. So that the kernels would find the descriptions in
+      // device memory.
+      const std::size_t table_size = packed.size() *
+                                     sizeof( copy_batch::segment );
+      const std::size_t data_offset =
+         ( ( table_size + copy_batch::packing_alignment - 1 ) /
+           copy_batch::packing_alignment ) * copy_batch::packing_alignment;
+      const std::size_t total_size = data_offset + batch.packed_size();
+      auto host = ::allocate_scratch( total_size, host_scratch );
+      auto device = ::allocate_scratch( total_size, device_scratch );
+      std::memcpy( host.get(), packed.data(), table_size );
+      const copy_batch::segment* device_table =
+         reinterpret_cast< const copy_batch::segment* >( device.get() );
+
+      if( cptype == vecmem::copy::type::host_to_device ) {
+         // Gather on the host, transfer everything at once, and scatter on
+         // the device.
+         for( const copy_batch::segment& s : packed ) {
+            std::memcpy( host.get() + data_offset + s.m_offset, s.m_from,
+                         s.m_size );
+         }
+         VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync(
+            device.get(), host.get(), total_size, cudaMemcpyHostToDevice,
+            cuda_stream ) );
+         details::scatter_batch( packed.size(), device_table,
+                                 device.get() + data_offset, cuda_stream );
+         stream.synchronize();
+      } else {
+         // Transfer the descriptions, gather on the device, transfer the
+         // data at once, and scatter on the host.
+         VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync(
+            device.get(), host.get(), table_size, cudaMemcpyHostToDevice,
+            cuda_stream ) );
+         details::gather_batch( packed.size(), device_table,
+                                device.get() + data_offset, cuda_stream );
+         VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync(
+            host.get() + data_offset, device.get() + data_offset,
+            batch.packed_size(), cudaMemcpyDeviceToHost, cuda_stream ) );
+         stream.synchronize();
+         for( const copy_batch::segment& s : packed ) {
+            std::memcpy( s.m_to, host.get() + data_offset + s.m_offset,
+                         s.m_size );
+         }
+      }
+   }
+
+} // namespace vecmem::cuda
@@ -0,0 +1,69 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "copy_batch_kernels.hpp"
+#include "../cuda_error_handling.hpp"
+
+namespace {
+
+   /// The number of threads to copy each segment with
+   static constexpr unsigned int THREADS_PER_SEGMENT = 256;
+
+   /// Kernel gathering one segment per block into the packed memory block
+   __global__
+   void gather_kernel( const vecmem::copy_batch::segment* segments,
+                       char* packed ) {
+
+      const vecmem::copy_batch::segment s = segments[ blockIdx.x ];
+      const char* from = static_cast< const char* >( s.m_from );
+      for( std::size_t i = threadIdx.x; i < s.m_size; i += blockDim.x ) {
+         packed[ s.m_offset + i ] = from[ i ];
+      }
+   }
+
+   /// Kernel scattering one segment per block out of the packed memory block
+   __global__
+   void scatter_kernel( const vecmem::copy_batch::segment* segments,
+                        const char* packed ) {
+
+      const vecmem::copy_batch::segment s = segments[ blockIdx.x ];
+      char* to = static_cast< char* >( s.m_to );
+      for( std::size_t i = threadIdx.x; i < s.m_size; i += blockDim.x ) {
+         to[ i ] = packed[ s.m_offset + i ];
+      }
+   }
+
+} // private namespace
+
+namespace vecmem::cuda::details {
+
+   void gather_batch( std::size_t n, const copy_batch::segment* segments,
+                      void* packed, cudaStream_t stream ) {
+
+      if( n == 0 ) {
+         return;
+      }
+      gather_kernel<<< static_cast< unsigned int >( n ), THREADS_PER_SEGMENT,
+                       0, stream >>>( segments,
+                                      static_cast< char* >( packed ) );
+      VECMEM_CUDA_ERROR_CHECK( cudaGetLastError() );
+   }
+
+   void scatter_batch( std::size_t n, const copy_batch::segment* segments,
+                       const void* packed, cudaStream_t stream ) {
+
+      if( n == 0 ) {
+         return;
+      }
+      scatter_kernel<<< static_cast< unsigned int >( n ), THREADS_PER_SEGMENT,
+                        0, stream >>>( segments,
+                                       static_cast< const char* >( packed ) );
+      VECMEM_CUDA_ERROR_CHECK( cudaGetLastError() );
+   }
+
+} // namespace vecmem::cuda::details
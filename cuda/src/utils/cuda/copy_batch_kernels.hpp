@@ -0,0 +1,40 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/copy_batch.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::cuda::details {
+
+   /// Gather device memory blocks into a packed device memory block
+   ///
+   /// @param n The number of segments to gather
+   /// @param segments The segment descriptions, in device memory
+   /// @param packed The packed memory block to fill
+   /// @param stream The stream to launch the kernel on
+   ///
+   void gather_batch( std::size_t n, const copy_batch::segment* segments,
+                      void* packed, cudaStream_t stream );
+
+   /// Scatter a packed device memory block into device memory blocks
+   ///
+   /// @param n The number of segments to scatter
+   /// @param segments The segment descriptions, in device memory
+   /// @param packed The packed memory block to read
+   /// @param stream The stream to launch the kernel on
+   ///
+   void scatter_batch( std::size_t n, const copy_batch::segment* segments,
+                       const void* packed, cudaStream_t stream );
+
+} // namespace vecmem::cuda::details
@@ -0,0 +1,18 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "get_stream.hpp"
+
+namespace vecmem::cuda::details {
+
+   cudaStream_t get_stream( const vecmem::cuda::stream_wrapper& stream ) {
+
+      return static_cast< cudaStream_t >( stream.stream() );
+   }
+
+} // namespace vecmem::cuda::details
@@ -0,0 +1,21 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Local include(s).
+#include "vecmem/utils/cuda/stream_wrapper.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+namespace vecmem::cuda::details {
+
+   /// Helper function for getting a @c cudaStream_t out of
+   /// @c vecmem::cuda::stream_wrapper
+   cudaStream_t get_stream( const vecmem::cuda::stream_wrapper& stream );
+
+} // namespace vecmem::cuda::details
@@ -0,0 +1,33 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+namespace vecmem::cuda::details {
+
+   /// Helper class for managing the lifetime of a @c cudaStream_t object
+   class opaque_stream {
+
+   public:
+      /// Create a new stream for the specified device
+      opaque_stream( int device );
+      /// Destroy the managed stream
+      ~opaque_stream();
+
+      /// The stream can not be copied
+      opaque_stream( const opaque_stream& ) = delete;
+      /// The stream can not be copied
+      opaque_stream& operator=( const opaque_stream& ) = delete;
+
+      /// The managed stream
+      cudaStream_t m_stream;
+
+   }; // class opaque_stream
+
+} // namespace vecmem::cuda::details
@@ -0,0 +1,130 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/cuda/resource_aware_copy.hpp"
+#include "vecmem/memory/cuda/async_device_memory_resource.hpp"
+#include "vecmem/memory/cuda/device_memory_resource.hpp"
+#include "vecmem/memory/cuda/host_memory_resource.hpp"
+#include "vecmem/memory/cuda/managed_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/cuda/copy.hpp"
+#include "../cuda_error_handling.hpp"
+#include "../cuda_wrappers.hpp"
+#include "get_stream.hpp"
+
+// CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <cstring>
+
+namespace {
+
+   /// Translate a copy type into a CUDA copy kind
+   cudaMemcpyKind copy_kind( vecmem::copy::type::copy_type type ) {
+
+      switch( type ) {
+      case vecmem::copy::type::host_to_device:
+         return cudaMemcpyHostToDevice;
+      case vecmem::copy::type::device_to_host:
+         return cudaMemcpyDeviceToHost;
+      case vecmem::copy::type::host_to_host:
+         return cudaMemcpyHostToHost;
+      case vecmem::copy::type::device_to_device:
+         return cudaMemcpyDeviceToDevice;
+      default:
+         return cudaMemcpyDefault;
+      }
+   }
+
+} // private namespace
+
+namespace vecmem::cuda {
+
+   resource_aware_copy::resource_aware_copy( const stream_wrapper& stream,
+                                             staging_pool* staging,
+                                             std::size_t staging_threshold )
+   : m_stream( stream ), m_staging( staging ),
+     m_staging_threshold( staging_threshold ), m_kinds() {
+
+   }
+
+   void resource_aware_copy::set_kind( const memory_resource& resource,
+                                       memory_kind::kind_type kind ) {
+
+      m_kinds.set( resource, kind );
+   }
+
+   memory_kind::kind_type
+   resource_aware_copy::kind( const memory_resource& resource ) const {
+
+      // Explicit settings take precedence.
+      const memory_kind::kind_type result = m_kinds.get( resource );
+      if( result != memory_kind::unknown ) {
+         return result;
+      }
+
+      // Recognise the resources of the library.
+      if( dynamic_cast< const vecmem::host_memory_resource* >( &resource ) ) {
+         return memory_kind::host;
+      }
+      if( dynamic_cast< const host_memory_resource* >( &resource ) ) {
+         return memory_kind::pinned_host;
+      }
+      if( dynamic_cast< const device_memory_resource* >( &resource ) ||
+          dynamic_cast< const async_device_memory_resource* >( &resource ) ) {
+         return memory_kind::device;
+      }
+      if( dynamic_cast< const managed_memory_resource* >( &resource ) ) {
+         return memory_kind::managed;
+      }
+      return memory_kind::unknown;
+   }
+
+   copy_decision
+   resource_aware_copy::do_copy( std::size_t size, const void* from,
+                                 memory_kind::kind_type from_kind, void* to,
+                                 memory_kind::kind_type to_kind ) {
+
+      // Decide what to do.
+      const copy_decision decision =
+         decide_copy( size, from_kind, from, to_kind, to,
+                      ( m_staging != nullptr ? m_staging_threshold : 0 ) );
+      cudaStream_t stream = details::get_stream( m_stream );
+
+      // Do it.
+      switch( decision.m_action ) {
+      case copy_decision::skip:
+         break;
+      case copy_decision::host_copy:
+         std::memcpy( to, from, size );
+         break;
+      case copy_decision::prefetch:
+         VECMEM_CUDA_ERROR_CHECK( cudaMemPrefetchAsync(
+            from, size,
+            ( decision.m_type == copy::type::host_to_device ?
+              details::get_device() : cudaCpuDeviceId ), stream ) );
+         m_stream.synchronize();
+         break;
+      case copy_decision::runtime_copy:
+         VECMEM_CUDA_ERROR_CHECK( cudaMemcpyAsync(
+            to, from, size, ::copy_kind( decision.m_type ), stream ) );
+         m_stream.synchronize();
+         break;
+      case copy_decision::staged_copy:
+         if( decision.m_type == copy::type::host_to_device ) {
+            details::copy_to_device( size, from, to, *m_staging, m_stream );
+         } else {
+            details::copy_to_host( size, from, to, *m_staging, m_stream );
+         }
+         break;
+      }
+      return decision;
+   }
+
+} // namespace vecmem::cuda
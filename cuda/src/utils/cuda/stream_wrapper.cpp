@@ -0,0 +1,69 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/utils/cuda/stream_wrapper.hpp"
+#include "../cuda_error_handling.hpp"
+#include "../cuda_wrappers.hpp"
+#include "../select_device.hpp"
+#include "get_stream.hpp"
+#include "opaque_stream.hpp"
+
+namespace vecmem::cuda {
+
+   namespace details {
+
+      opaque_stream::opaque_stream( int device )
+      : m_stream( nullptr ) {
+
+         select_device dev( device >= 0 ? device : get_device() );
+         VECMEM_CUDA_ERROR_CHECK( cudaStreamCreate( &m_stream ) );
+      }
+
+      opaque_stream::~opaque_stream() {
+
+         // Don't throw from the destructor.
+         VECMEM_CUDA_ERROR_IGNORE( cudaStreamDestroy( m_stream ) );
+      }
+
+   } // namespace details
+
+   stream_wrapper::stream_wrapper( int device )
+   : m_stream( nullptr ),
+     m_managedStream( std::make_shared< details::opaque_stream >( device ) ) {
+
+      m_stream = m_managedStream->m_stream;
+   }
+
+   stream_wrapper::stream_wrapper( void* stream )
+   : m_stream( stream ), m_managedStream() {
+
+   }
+
+   stream_wrapper::stream_wrapper( const stream_wrapper& parent ) = default;
+
+   stream_wrapper::stream_wrapper( stream_wrapper&& parent ) = default;
+
+   stream_wrapper::~stream_wrapper() {}
+
+   stream_wrapper&
+   stream_wrapper::operator=( const stream_wrapper& rhs ) = default;
+
+   stream_wrapper& stream_wrapper::operator=( stream_wrapper&& rhs ) = default;
+
+   void* stream_wrapper::stream() const {
+
+      return m_stream;
+   }
+
+   void stream_wrapper::synchronize() {
+
+      VECMEM_CUDA_ERROR_CHECK(
+         cudaStreamSynchronize( details::get_stream( *this ) ) );
+   }
+
+} // namespace vecmem::cuda
@@ -14,17 +14,22 @@ namespace vecmem::cuda::details {
         /*
          * When the object is constructed, grab the current device number and
          * store it as a member variable. Then set the device to whatever was
-         * specified.
+         * specified, if it is not the current device already.
          */
         VECMEM_CUDA_ERROR_CHECK(cudaGetDevice(&m_device));
-        VECMEM_CUDA_ERROR_CHECK(cudaSetDevice(device));
+        m_switched = (device != m_device);
+        if (m_switched) {
+            VECMEM_CUDA_ERROR_CHECK(cudaSetDevice(device));
+        }
     }
 
     select_device::~select_device() {
         /*
          * On destruction, reset the device number to whatever it was before the
-         * object was constructed.
+         * object was constructed. (If it was changed at all.)
          */
-        VECMEM_CUDA_ERROR_CHECK(cudaSetDevice(m_device));
+        if (m_switched) {
+            VECMEM_CUDA_ERROR_CHECK(cudaSetDevice(m_device));
+        }
     }
 }
\ No newline at end of file
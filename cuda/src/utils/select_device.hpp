@@ -45,5 +45,11 @@ namespace vecmem::cuda::details {
              * object goes out of scope.
              */
             int m_device;
+
+            /**
+             * @brief Whether the constructor had to switch the device. If
+             * not, there is nothing to restore either.
+             */
+            bool m_switched;
     };
 }
\ No newline at end of file
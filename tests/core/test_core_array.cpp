@@ -17,6 +17,9 @@
 #include <gtest/gtest.h>
 
 // System include(s).
+#include <memory>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -152,6 +155,101 @@ TEST_P( core_array_test, constructor_destructor ) {
    EXPECT_EQ( dummy, 4 );
 }
 
+/// Test the constructors that do not initialise the array elements
+TEST_P( core_array_test, no_init ) {
+
+   // Trivial types can be used like with the other constructors.
+   vecmem::array< int, 10 > a1( *( GetParam() ), vecmem::no_init );
+   test_array( a1 );
+   vecmem::array< double > a2( *( GetParam() ), 20, vecmem::no_init );
+   test_array( a2 );
+
+   // Non-trivial types still need to be constructed and destructed.
+   int dummy = 5;
+   {
+      vecmem::array< TestType2 > a3( *( GetParam() ), 5, vecmem::no_init );
+      EXPECT_EQ( a3.front().m_value, 11 );
+      a3.back().m_pointer = &dummy;
+   }
+   EXPECT_EQ( dummy, 4 );
+}
+
+/// Test arrays with a compile time size, and inline storage
+TEST_P( core_array_test, compile_time ) {
+
+   // Arrays with a compile time size should not store their size, neither
+   // in the array nor in its deleter.
+   typedef vecmem::array< int, 10000 > large_array;
+   EXPECT_EQ( sizeof( large_array::deleter ),
+              sizeof( vecmem::memory_resource* ) );
+   EXPECT_EQ( sizeof( large_array ),
+              sizeof( std::unique_ptr< int, large_array::deleter > ) );
+
+   // Test a small array with its elements stored inline.
+   vecmem::array< TestType1, 8 > a1;
+   EXPECT_GE( static_cast< const void* >( a1.data() ),
+              static_cast< const void* >( &a1 ) );
+   EXPECT_LT( static_cast< const void* >( a1.data() ),
+              static_cast< const void* >( &a1 + 1 ) );
+   test_array( a1 );
+
+   // Move arrays with inline and with allocated storage.
+   vecmem::array< TestType1, 8 > a2( *( GetParam() ) );
+   a2.fill( TestType1( 5 ) );
+   a1.fill( TestType1( 6 ) );
+   vecmem::array< TestType1, 8 > a3( std::move( a1 ) );
+   EXPECT_EQ( a3.front(), TestType1( 6 ) );
+   EXPECT_EQ( a3.back(), TestType1( 6 ) );
+   a1 = std::move( a2 );
+   EXPECT_EQ( a1.front(), TestType1( 5 ) );
+   EXPECT_EQ( a1.back(), TestType1( 5 ) );
+   a2 = std::move( a3 );
+   EXPECT_EQ( a2.front(), TestType1( 6 ) );
+   test_array( a2 );
+
+   // Move arrays with a runtime size.
+   vecmem::array< int > a4( *( GetParam() ), 20 );
+   vecmem::array< int > a5( std::move( a4 ) );
+   EXPECT_EQ( a5.size(), 20u );
+   EXPECT_EQ( a4.size(), 0u );
+   test_array( a5 );
+
+   // Moved-from arrays with a compile time size and allocated storage should
+   // be safe to use as empty arrays.
+   typedef vecmem::array< int, 100 > allocated_array;
+   allocated_array a6( *( GetParam() ) );
+   a6.fill( 3 );
+   allocated_array a7( std::move( a6 ) );
+   EXPECT_EQ( a7.size(), 100u );
+   EXPECT_EQ( a7.back(), 3 );
+   EXPECT_EQ( a6.size(), 0u );
+   EXPECT_TRUE( a6.empty() );
+   EXPECT_EQ( a6.begin(), a6.end() );
+   a6.fill( 4 );
+   for( int value : a6 ) {
+      EXPECT_EQ( value, 4 );
+   }
+   EXPECT_THROW( a6.at( 0 ), std::out_of_range );
+   a6 = std::move( a7 );
+   EXPECT_EQ( a6.size(), 100u );
+   EXPECT_EQ( a6.front(), 3 );
+   EXPECT_EQ( a7.size(), 0u );
+
+   // The same should hold for small arrays that were given a resource.
+   vecmem::array< int, 4 > a8( *( GetParam() ) );
+   a8.fill( 5 );
+   vecmem::array< int, 4 > a9( std::move( a8 ) );
+   EXPECT_EQ( a9.size(), 4u );
+   EXPECT_EQ( a9.back(), 5 );
+   EXPECT_EQ( a8.size(), 0u );
+   EXPECT_TRUE( a8.empty() );
+   EXPECT_EQ( a8.begin(), a8.end() );
+   a8.fill( 6 );
+   EXPECT_THROW( a8.front(), std::out_of_range );
+   EXPECT_THROW( a8.back(), std::out_of_range );
+   EXPECT_EQ( vecmem::get_data( a8 ).m_size, 0u );
+}
+
 // Memory resources to use in the test.
 static vecmem::host_memory_resource host_resource;
 static vecmem::binary_page_memory_resource binary_resource( host_resource );
@@ -0,0 +1,261 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_data.hpp"
+#include "vecmem/containers/jagged_device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/io/binary_io.hpp"
+#include "vecmem/io/mapped_file.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// Test case for the vecmem binary I/O code
+class core_binary_io_test : public testing::Test {
+
+protected:
+   /// Set up the test data
+   void SetUp() override {
+
+      std::iota( m_vector.begin(), m_vector.end(), 0.5 );
+      for( std::size_t i = 0; i < 20; ++i ) {
+         m_jagged.push_back(
+            vecmem::vector< int >( ( i * 7 ) % 5, static_cast< int >( i ),
+                                   &m_resource ) );
+      }
+   }
+
+   /// Remove the temporary file, if it was created
+   void TearDown() override {
+
+      std::remove( m_file_name.c_str() );
+   }
+
+   /// Helper function comparing the contents of jagged vectors
+   template< typename TYPE >
+   void compare( const vecmem::data::jagged_vector_view< TYPE >& data ) {
+
+      vecmem::jagged_device_vector< TYPE > device( data );
+      ASSERT_EQ( device.size(), m_jagged.size() );
+      for( std::size_t i = 0; i < m_jagged.size(); ++i ) {
+         ASSERT_EQ( device.at( i ).size(), m_jagged.at( i ).size() );
+         EXPECT_TRUE( std::equal( m_jagged.at( i ).begin(),
+                                  m_jagged.at( i ).end(),
+                                  device.at( i ).begin() ) );
+      }
+   }
+
+   /// Memory resource used in the tests
+   vecmem::host_memory_resource m_resource;
+   /// 1-dimensional test vector
+   vecmem::vector< double > m_vector{ 1000, &m_resource };
+   /// Jagged test vector
+   vecmem::jagged_vector< int > m_jagged{ &m_resource };
+   /// Name of the temporary file used by the tests
+   const std::string m_file_name = "vecmem_test_core_binary_io.bin";
+
+}; // class core_binary_io_test
+
+/// Test writing and reading a 1-dimensional vector through a stream
+TEST_F( core_binary_io_test, vector_stream ) {
+
+   std::stringstream stream;
+   vecmem::io::write_binary( stream, vecmem::get_data( m_vector ) );
+   auto buffer = vecmem::io::read_binary_vector< double >( stream, m_resource );
+   ASSERT_EQ( buffer.m_size, m_vector.size() );
+   EXPECT_TRUE( std::equal( m_vector.begin(), m_vector.end(), buffer.m_ptr ) );
+}
+
+/// Test writing and reading a jagged vector through a stream
+TEST_F( core_binary_io_test, jagged_stream ) {
+
+   std::stringstream stream;
+   vecmem::data::jagged_vector_data< int > data( m_jagged );
+   vecmem::io::write_binary( stream, data );
+   auto buffer =
+      vecmem::io::read_binary_jagged_vector< int >( stream, m_resource );
+   EXPECT_EQ( buffer.layout().m_rows, m_jagged.size() );
+   compare( buffer );
+}
+
+/// Test the detection of invalid/unexpected content
+TEST_F( core_binary_io_test, invalid_content ) {
+
+   // Garbage input.
+   std::stringstream garbage( std::string( 100, 'x' ) );
+   EXPECT_THROW( vecmem::io::read_binary_vector< double >( garbage,
+                                                           m_resource ),
+                 std::runtime_error );
+
+   // Wrong element type.
+   std::stringstream stream1;
+   vecmem::io::write_binary( stream1, vecmem::get_data( m_vector ) );
+   EXPECT_THROW( vecmem::io::read_binary_vector< float >( stream1,
+                                                          m_resource ),
+                 std::runtime_error );
+
+   // Wrong type of content.
+   std::stringstream stream2;
+   vecmem::io::write_binary( stream2, vecmem::get_data( m_vector ) );
+   EXPECT_THROW( vecmem::io::read_binary_jagged_vector< double >( stream2,
+                                                                  m_resource ),
+                 std::runtime_error );
+}
+
+/// Test reading the data through a memory mapped file
+TEST_F( core_binary_io_test, mapped_file ) {
+
+   // Write a 1-dimensional vector, and check it through a mapping.
+   {
+      std::ofstream out( m_file_name, std::ios::binary );
+      vecmem::io::write_binary( out, vecmem::get_data( m_vector ) );
+   }
+   {
+      vecmem::io::mapped_file file( m_file_name );
+      EXPECT_EQ( file.header().m_content, vecmem::io::binary_content::vector );
+      auto view = file.view< double >();
+      ASSERT_EQ( view.m_size, m_vector.size() );
+      EXPECT_EQ( reinterpret_cast< std::uintptr_t >( view.m_ptr ) %
+                 vecmem::io::binary_payload_alignment, 0u );
+      EXPECT_TRUE( std::equal( m_vector.begin(), m_vector.end(),
+                               view.m_ptr ) );
+      EXPECT_THROW( file.view< float >(), std::runtime_error );
+   }
+
+   // Write a jagged vector, and check it through a mapping.
+   {
+      std::ofstream out( m_file_name, std::ios::binary );
+      vecmem::data::jagged_vector_data< int > data( m_jagged );
+      vecmem::io::write_binary( out, data );
+   }
+   {
+      vecmem::io::mapped_file file( m_file_name );
+      vecmem::io::mapped_file moved( std::move( file ) );
+      EXPECT_EQ( file.data(), nullptr );
+      auto views = moved.jagged_view< int >( m_resource );
+      compare( views );
+   }
+
+   // Check that missing files are reported correctly.
+   EXPECT_THROW( vecmem::io::mapped_file( "non_existent_file.bin" ),
+                 std::runtime_error );
+}
+
+/// Test the detection of corrupt jagged vector offsets
+TEST_F( core_binary_io_test, corrupt_offsets ) {
+
+   // Write the jagged vector into a string.
+   std::stringstream stream;
+   vecmem::data::jagged_vector_data< int > data( m_jagged );
+   vecmem::io::write_binary( stream, data );
+   const std::string good = stream.str();
+
+   // Helper lambda overwriting one of the offsets.
+   auto corrupt = [ &good ]( std::size_t index, std::uint64_t value ) {
+      std::string result = good;
+      std::memcpy( &( result[ sizeof( vecmem::io::binary_header ) +
+                              index * sizeof( std::uint64_t ) ] ),
+                   &value, sizeof( value ) );
+      return result;
+   };
+   const std::size_t rows = m_jagged.size();
+   const std::vector< std::string > corrupted = {
+      // Not starting at zero.
+      corrupt( 0, 1 ),
+      // Decreasing offsets.
+      corrupt( 5, 1000000 ),
+      // Not ending at the number of elements.
+      corrupt( rows, 3 ),
+      // Offsets cut short.
+      good.substr( 0, sizeof( vecmem::io::binary_header ) +
+                      sizeof( std::uint64_t ) * rows / 2 ) };
+
+   for( const std::string& bad : corrupted ) {
+      // Check reading it through a stream.
+      std::stringstream in( bad );
+      EXPECT_THROW( vecmem::io::read_binary_jagged_vector< int >(
+                       in, m_resource ),
+                    std::runtime_error );
+
+      // Check reading it through a memory mapping.
+      {
+         std::ofstream out( m_file_name, std::ios::binary );
+         out.write( bad.data(), bad.size() );
+      }
+      vecmem::io::mapped_file file( m_file_name );
+      EXPECT_THROW( file.jagged_view< int >( m_resource ),
+                    std::runtime_error );
+   }
+}
+
+/// Test the detection of headers describing impossibly large payloads
+TEST_F( core_binary_io_test, corrupt_sizes ) {
+
+   // Write the test vectors into strings.
+   std::stringstream vstream, jstream;
+   vecmem::io::write_binary( vstream, vecmem::get_data( m_vector ) );
+   vecmem::data::jagged_vector_data< int > data( m_jagged );
+   vecmem::io::write_binary( jstream, data );
+
+   // Helper lambda overwriting one of the sizes in the header.
+   auto corrupt = []( std::string input, std::uint64_t rows,
+                      std::uint64_t elements ) {
+      vecmem::io::binary_header header;
+      std::memcpy( &header, input.data(), sizeof( header ) );
+      header.m_rows = rows;
+      header.m_elements = elements;
+      std::memcpy( &( input[ 0 ] ), &header, sizeof( header ) );
+      return input;
+   };
+
+   // Element counts that overflow the size of the payload in bytes.
+   const std::string bad_vector =
+      corrupt( vstream.str(), 0, std::uint64_t( 1 ) << 61 );
+   std::stringstream vin( bad_vector );
+   EXPECT_THROW( vecmem::io::read_binary_vector< double >( vin, m_resource ),
+                 std::runtime_error );
+   {
+      std::ofstream out( m_file_name, std::ios::binary );
+      out.write( bad_vector.data(), bad_vector.size() );
+   }
+   {
+      vecmem::io::mapped_file file( m_file_name );
+      EXPECT_THROW( file.view< double >(), std::runtime_error );
+   }
+
+   // Row counts that overflow the size of the offsets table.
+   const std::string bad_jagged =
+      corrupt( jstream.str(), ~std::uint64_t( 0 ), 0 );
+   std::stringstream jin( bad_jagged );
+   EXPECT_THROW( vecmem::io::read_binary_jagged_vector< int >( jin,
+                                                               m_resource ),
+                 std::runtime_error );
+   {
+      std::ofstream out( m_file_name, std::ios::binary );
+      out.write( bad_jagged.data(), bad_jagged.size() );
+   }
+   {
+      vecmem::io::mapped_file file( m_file_name );
+      EXPECT_THROW( file.jagged_view< int >( m_resource ),
+                    std::runtime_error );
+   }
+}
@@ -0,0 +1,105 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/bitset_vector.hpp"
+#include "vecmem/containers/device_bitset.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <cstddef>
+
+/// Test case for @c vecmem::bitset_vector and @c vecmem::device_bitset
+class core_bitset_vector_test : public testing::Test {
+
+protected:
+   /// Memory resource used in the tests
+   vecmem::host_memory_resource m_resource;
+
+}; // class core_bitset_vector_test
+
+/// Test the single bit functions
+TEST_F( core_bitset_vector_test, single_bits ) {
+
+   vecmem::bitset_vector bits( 100, m_resource );
+   EXPECT_EQ( bits.size(), 100u );
+   EXPECT_EQ( bits.count(), 0u );
+   EXPECT_TRUE( bits.none() );
+
+   for( std::size_t i = 0; i < bits.size(); i += 3 ) {
+      bits.set( i );
+   }
+   EXPECT_EQ( bits.count(), 34u );
+   EXPECT_TRUE( bits.any() );
+   for( std::size_t i = 0; i < bits.size(); ++i ) {
+      EXPECT_EQ( bits[ i ], i % 3 == 0 );
+   }
+   EXPECT_TRUE( bits.test_and_set( 99 ) );
+   EXPECT_FALSE( bits.test_and_set( 98 ) );
+   EXPECT_TRUE( bits.test( 98 ) );
+   bits.reset( 98 );
+   bits.reset( 0 );
+   EXPECT_FALSE( bits.test( 98 ) );
+   EXPECT_FALSE( bits.test( 0 ) );
+   EXPECT_EQ( bits.count(), 33u );
+
+   // The unused bits must not be counted.
+   vecmem::bitset_vector full( 37, m_resource, true );
+   EXPECT_EQ( full.count(), 37u );
+   full.fill( false );
+   EXPECT_TRUE( full.none() );
+}
+
+/// Test the whole-bitset operations
+TEST_F( core_bitset_vector_test, bitwise_operations ) {
+
+   vecmem::bitset_vector a( 1000, m_resource ), b( 1000, m_resource );
+   for( std::size_t i = 0; i < 1000; ++i ) {
+      if( i % 2 == 0 ) {
+         a.set( i );
+      }
+      if( i % 3 == 0 ) {
+         b.set( i );
+      }
+   }
+   vecmem::bitset_vector result( 1000, m_resource );
+   result |= a.data();
+   result &= b.data();
+   EXPECT_EQ( result.count(), 167u );
+   result |= a.data();
+   EXPECT_EQ( result.count(), 500u );
+   result ^= b.data();
+   for( std::size_t i = 0; i < 1000; ++i ) {
+      EXPECT_EQ( result[ i ], ( i % 2 == 0 ) != ( i % 3 == 0 ) );
+   }
+}
+
+/// Test claiming bits from multiple threads, through the view
+TEST_F( core_bitset_vector_test, concurrent_claims ) {
+
+   static constexpr std::size_t SIZE = 10000;
+   vecmem::bitset_vector bits( SIZE, m_resource );
+   const vecmem::data::bitset_view view = vecmem::get_data( bits );
+   std::atomic< std::size_t > claimed( 0 );
+   vecmem::thread_pool pool( 4 );
+   pool.parallel_for( 4 * SIZE, [ &view, &claimed ]( std::size_t begin,
+                                                     std::size_t end ) {
+      vecmem::device_bitset device( view );
+      for( std::size_t i = begin; i < end; ++i ) {
+         if( ! device.test_and_set( i % SIZE ) ) {
+            ++claimed;
+         }
+      }
+   }, 100 );
+   EXPECT_EQ( claimed.load(), SIZE );
+   EXPECT_EQ( bits.count(), SIZE );
+}
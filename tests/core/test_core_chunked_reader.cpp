@@ -0,0 +1,132 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_data.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/io/binary_io.hpp"
+#include "vecmem/io/chunked_reader.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+/// Test case for @c vecmem::io::chunked_reader
+class core_chunked_reader_test : public testing::Test {
+
+protected:
+   /// Remove the temporary file, if it was created
+   void TearDown() override {
+
+      std::remove( m_file_name.c_str() );
+   }
+
+   /// Memory resource used in the tests
+   vecmem::host_memory_resource m_resource;
+   /// Name of the temporary file used by the tests
+   const std::string m_file_name = "vecmem_test_core_chunked_reader.bin";
+
+}; // class core_chunked_reader_test
+
+/// Test reading a 1-dimensional vector in chunks
+TEST_F( core_chunked_reader_test, vector ) {
+
+   // Write a vector whose size is not a multiple of the chunk size.
+   vecmem::vector< int > input( 10007, &m_resource );
+   std::iota( input.begin(), input.end(), 0 );
+   {
+      std::ofstream out( m_file_name, std::ios::binary );
+      vecmem::io::write_binary( out, vecmem::get_data( input ) );
+   }
+
+   // Read it back in chunks.
+   vecmem::io::chunked_reader< int > reader( m_file_name, 1000, m_resource );
+   EXPECT_EQ( reader.size(), input.size() );
+   EXPECT_EQ( reader.chunk_size(), 1000u );
+   std::size_t chunks = 0, elements = 0;
+   const int* previous = nullptr;
+   for( auto chunk = reader.next(); chunk.m_size != 0;
+        chunk = reader.next() ) {
+      // Consecutive chunks need to come from different buffers.
+      EXPECT_NE( chunk.m_ptr, previous );
+      previous = chunk.m_ptr;
+      ASSERT_LE( chunk.m_size, 1000u );
+      for( std::size_t i = 0; i < chunk.m_size; ++i ) {
+         EXPECT_EQ( chunk.m_ptr[ i ], static_cast< int >( elements + i ) );
+      }
+      elements += chunk.m_size;
+      ++chunks;
+   }
+   EXPECT_EQ( chunks, 11u );
+   EXPECT_EQ( elements, input.size() );
+
+   // The end of the file is reported repeatedly.
+   EXPECT_EQ( reader.next().m_size, 0u );
+}
+
+/// Test reading the payload of a jagged vector in chunks
+TEST_F( core_chunked_reader_test, jagged_vector ) {
+
+   // Write a jagged vector.
+   vecmem::jagged_vector< float > input( &m_resource );
+   std::size_t total = 0;
+   for( std::size_t i = 0; i < 50; ++i ) {
+      input.push_back( vecmem::vector< float >( i % 7, static_cast< float >( i ),
+                                                &m_resource ) );
+      total += i % 7;
+   }
+   {
+      std::ofstream out( m_file_name, std::ios::binary );
+      vecmem::data::jagged_vector_data< float > data( input );
+      vecmem::io::write_binary( out, data );
+   }
+
+   // Read its payload back in chunks, and compare it to the original.
+   vecmem::io::chunked_reader< float > reader( m_file_name, 16, m_resource );
+   EXPECT_EQ( reader.size(), total );
+   std::size_t row = 0, column = 0, elements = 0;
+   for( auto chunk = reader.next(); chunk.m_size != 0;
+        chunk = reader.next() ) {
+      for( std::size_t i = 0; i < chunk.m_size; ++i ) {
+         while( column == input.at( row ).size() ) {
+            ++row;
+            column = 0;
+         }
+         EXPECT_EQ( chunk.m_ptr[ i ], input.at( row ).at( column ) );
+         ++column;
+      }
+      elements += chunk.m_size;
+   }
+   EXPECT_EQ( elements, total );
+}
+
+/// Test the error handling of the reader
+TEST_F( core_chunked_reader_test, errors ) {
+
+   // Missing file.
+   EXPECT_THROW( vecmem::io::chunked_reader< int >( "non_existent_file.bin",
+                                                    10, m_resource ),
+                 std::runtime_error );
+
+   // Wrong element type.
+   vecmem::vector< double > input( 100, 1.0, &m_resource );
+   {
+      std::ofstream out( m_file_name, std::ios::binary );
+      vecmem::io::write_binary( out, vecmem::get_data( input ) );
+   }
+   EXPECT_THROW( vecmem::io::chunked_reader< float >( m_file_name, 10,
+                                                      m_resource ),
+                 std::runtime_error );
+}
@@ -0,0 +1,251 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_buffer.hpp"
+#include "vecmem/containers/data/jagged_vector_data.hpp"
+#include "vecmem/containers/jagged_device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/contiguous_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/async_host_copy.hpp"
+#include "vecmem/utils/copy.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+   /// Copy backend counting the "low level" copies made through it
+   class counting_copy : public vecmem::copy {
+
+   public:
+      /// The number of copies made
+      std::size_t m_copies = 0;
+
+   protected:
+      void do_copy( std::size_t size, const void* from, void* to,
+                    type::copy_type cptype ) override {
+         ++m_copies;
+         vecmem::copy::do_copy( size, from, to, cptype );
+      }
+
+   }; // class counting_copy
+
+} // private namespace
+
+/// Test case for @c vecmem::copy and its host backends
+class core_copy_test : public testing::Test {
+
+protected:
+   /// Memory resource used in the tests
+   vecmem::host_memory_resource m_resource;
+
+}; // class core_copy_test
+
+/// Test the simple, synchronous copies of the base class
+TEST_F( core_copy_test, basic_copy ) {
+
+   // Create the input vector.
+   vecmem::vector< int > input( 100, &m_resource );
+   std::iota( input.begin(), input.end(), 0 );
+
+   // Copy it into a new buffer.
+   vecmem::copy copy;
+   vecmem::data::vector_buffer< int > buffer =
+      copy.to( vecmem::get_data( std::as_const( input ) ), m_resource );
+   ASSERT_EQ( buffer.m_size, input.size() );
+   EXPECT_TRUE( std::equal( input.begin(), input.end(), buffer.m_ptr ) );
+
+   // Copy it into another vector.
+   vecmem::vector< int > output( input.size(), &m_resource );
+   copy( vecmem::get_data( std::as_const( input ) ),
+         vecmem::get_data( output ) );
+   EXPECT_EQ( input, output );
+
+   // The asynchronous copy of the base class should finish right away.
+   vecmem::vector< int > output2( input.size(), &m_resource );
+   auto event = copy.async( vecmem::get_data( std::as_const( input ) ),
+                            vecmem::get_data( output2 ) );
+   EXPECT_TRUE( event->ready() );
+   EXPECT_EQ( input, output2 );
+}
+
+/// Test the asynchronous copies of the thread pool backend
+TEST_F( core_copy_test, async_host_copy ) {
+
+   // Use a small chunk size, to exercise the splitting of the copies.
+   vecmem::thread_pool pool( 4 );
+   vecmem::async_host_copy copy( pool, 1000 );
+   EXPECT_EQ( copy.chunk_size(), 1000 );
+
+   // Create the input vector, with a size that is not a multiple of the
+   // chunk size.
+   vecmem::vector< double > input( 12345, &m_resource );
+   std::iota( input.begin(), input.end(), 1.0 );
+
+   // Launch a number of copies in parallel.
+   static constexpr std::size_t N_COPIES = 5;
+   std::vector< vecmem::vector< double > >
+      outputs( N_COPIES, vecmem::vector< double >( input.size(),
+                                                   &m_resource ) );
+   std::vector< vecmem::copy::event_type > events;
+   for( vecmem::vector< double >& output : outputs ) {
+      events.push_back(
+         copy.async( vecmem::get_data( std::as_const( input ) ),
+                     vecmem::get_data( output ),
+                     vecmem::copy::type::host_to_host ) );
+   }
+
+   // Wait for them, and check the results.
+   for( std::size_t i = 0; i < N_COPIES; ++i ) {
+      events[ i ]->wait();
+      EXPECT_TRUE( events[ i ]->ready() );
+      EXPECT_EQ( input, outputs[ i ] );
+   }
+
+   // Check that synchronous copies work as well.
+   vecmem::data::vector_buffer< double > buffer =
+      copy.to( vecmem::get_data( std::as_const( input ) ), m_resource );
+   EXPECT_TRUE( std::equal( input.begin(), input.end(), buffer.m_ptr ) );
+}
+
+/// Test the handling of empty copies
+TEST_F( core_copy_test, empty_copy ) {
+
+   vecmem::async_host_copy copy;
+   vecmem::vector< int > input( &m_resource ), output( &m_resource );
+   auto event = copy.async( vecmem::get_data( std::as_const( input ) ),
+                            vecmem::get_data( output ) );
+   event->wait();
+   EXPECT_TRUE( event->ready() );
+}
+
+/// Test copying a jagged vector into a contiguous memory resource
+TEST_F( core_copy_test, jagged_host_to_host ) {
+
+   // Create the input jagged vector.
+   vecmem::jagged_vector< int > input(
+      { vecmem::vector< int >( { 1, 2, 3, 4 }, &m_resource ),
+        vecmem::vector< int >( { 5, 6 }, &m_resource ),
+        vecmem::vector< int >( &m_resource ),
+        vecmem::vector< int >( { 7, 8, 9 }, &m_resource ) }, &m_resource );
+   vecmem::data::jagged_vector_data< int > input_data( input, &m_resource );
+
+   // Copy it into a contiguous memory resource.
+   vecmem::contiguous_memory_resource target( m_resource, 4096 );
+   vecmem::copy copy;
+   vecmem::data::jagged_vector_buffer< int > buffer =
+      copy.to( input_data, target, vecmem::copy::type::host_to_host );
+
+   // Check that the views and the payload are all in the single block.
+   const char* begin = static_cast< const char* >( buffer.memory() );
+   const char* end = begin + buffer.layout().m_total_bytes;
+   ASSERT_EQ( buffer.m_size, input.size() );
+   EXPECT_EQ( static_cast< const void* >( buffer.m_ptr ), buffer.memory() );
+   for( std::size_t i = 0; i < buffer.m_size; ++i ) {
+      const char* row =
+         reinterpret_cast< const char* >( buffer.m_ptr[ i ].m_ptr );
+      EXPECT_GE( row, begin );
+      EXPECT_LE( row + buffer.m_ptr[ i ].m_size * sizeof( int ), end );
+   }
+
+   // Check the contents of the copy.
+   vecmem::jagged_device_vector< int > output( buffer );
+   ASSERT_EQ( output.size(), input.size() );
+   for( std::size_t i = 0; i < input.size(); ++i ) {
+      ASSERT_EQ( output.at( i ).size(), input.at( i ).size() );
+      for( std::size_t j = 0; j < input.at( i ).size(); ++j ) {
+         EXPECT_EQ( output.at( i, j ), input.at( i ).at( j ) );
+      }
+   }
+}
+
+/// Test copying a jagged vector through a staging area
+TEST_F( core_copy_test, jagged_staged ) {
+
+   // Create the input jagged vector.
+   vecmem::jagged_vector< double > input( &m_resource );
+   for( std::size_t i = 0; i < 50; ++i ) {
+      input.push_back( vecmem::vector< double >( i % 7, 1.5 * i,
+                                                 &m_resource ) );
+   }
+   vecmem::data::jagged_vector_data< double > input_data( input );
+
+   // Copy it using the thread pool backend.
+   vecmem::async_host_copy copy( 64 );
+   vecmem::data::jagged_vector_buffer< double > buffer =
+      copy.to( input_data, m_resource );
+   EXPECT_EQ( buffer.layout().m_elements, 147u );
+
+   // Check the contents of the copy.
+   vecmem::jagged_device_vector< double > output( buffer );
+   ASSERT_EQ( output.size(), input.size() );
+   for( std::size_t i = 0; i < input.size(); ++i ) {
+      ASSERT_EQ( output.at( i ).size(), input.at( i ).size() );
+      for( std::size_t j = 0; j < input.at( i ).size(); ++j ) {
+         EXPECT_EQ( output.at( i, j ), input.at( i ).at( j ) );
+      }
+   }
+}
+
+/// Test performing a batch of copies
+TEST_F( core_copy_test, batched_copy ) {
+
+   // Set up a number of small, and a few large vectors.
+   std::vector< vecmem::vector< int > > inputs, outputs;
+   for( std::size_t i = 0; i < 40; ++i ) {
+      const std::size_t size = ( i % 10 == 0 ? 1000 + i : i % 7 );
+      inputs.emplace_back( size, &m_resource );
+      std::iota( inputs.back().begin(), inputs.back().end(),
+                 static_cast< int >( i * 100 ) );
+      outputs.emplace_back( size, 0, &m_resource );
+   }
+
+   // Describe the copies between them.
+   vecmem::copy_batch batch( 1000 );
+   for( std::size_t i = 0; i < inputs.size(); ++i ) {
+      batch.add( vecmem::get_data( std::as_const( inputs[ i ] ) ),
+                 vecmem::get_data( outputs[ i ] ) );
+   }
+   EXPECT_EQ( batch.direct().size(), 4u );
+   EXPECT_EQ( batch.packed().size(), 31u );
+   for( const vecmem::copy_batch::segment& s : batch.packed() ) {
+      EXPECT_EQ( s.m_offset % vecmem::copy_batch::packing_alignment, 0u );
+      EXPECT_LE( s.m_offset + s.m_size, batch.packed_size() );
+   }
+
+   // Perform them, with a single copy for all of the small vectors.
+   counting_copy copy;
+   copy( batch, m_resource, m_resource, vecmem::copy::type::host_to_device );
+   EXPECT_EQ( copy.m_copies, 5u );
+   EXPECT_EQ( inputs, outputs );
+
+   // Host-to-host copies should be performed one by one.
+   for( vecmem::vector< int >& output : outputs ) {
+      std::fill( output.begin(), output.end(), 0 );
+   }
+   copy.m_copies = 0;
+   copy( batch, m_resource, m_resource, vecmem::copy::type::host_to_host );
+   EXPECT_EQ( copy.m_copies, 35u );
+   EXPECT_EQ( inputs, outputs );
+
+   // Empty batches should not do anything.
+   batch.clear();
+   EXPECT_TRUE( batch.empty() );
+   copy.m_copies = 0;
+   copy( batch, m_resource, m_resource );
+   EXPECT_EQ( copy.m_copies, 0u );
+}
@@ -0,0 +1,104 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy_decision.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+namespace {
+
+   /// Shorthand for the memory kinds
+   typedef vecmem::memory_kind mk;
+   /// Shorthand for the copy actions
+   typedef vecmem::copy_decision cd;
+   /// Shorthand for the copy types
+   typedef vecmem::copy::type ct;
+
+   /// Helper function checking a decision
+   void check( const vecmem::copy_decision& decision, cd::action_type action,
+               ct::copy_type type ) {
+      EXPECT_EQ( decision.m_action, action );
+      EXPECT_EQ( decision.m_type, type );
+   }
+
+} // private namespace
+
+/// Test case for @c vecmem::decide_copy
+class core_copy_decision_test : public testing::Test {
+
+protected:
+   /// Dummy memory blocks used in the tests
+   char m_a[ 16 ], m_b[ 16 ];
+
+}; // class core_copy_decision_test
+
+/// Test the skipped copies and the prefetches
+TEST_F( core_copy_decision_test, skip_and_prefetch ) {
+
+   check( vecmem::decide_copy( 0, mk::host, m_a, mk::device, m_b ),
+          cd::skip, ct::unknown );
+   for( mk::kind_type kind : { mk::host, mk::pinned_host, mk::device,
+                               mk::managed, mk::shared, mk::unknown } ) {
+      check( vecmem::decide_copy( 16, kind, m_a, kind, m_a ),
+             cd::skip, ct::unknown );
+   }
+   check( vecmem::decide_copy( 16, mk::managed, m_a, mk::device, m_a ),
+          cd::prefetch, ct::host_to_device );
+   check( vecmem::decide_copy( 16, mk::managed, m_a, mk::host, m_a ),
+          cd::prefetch, ct::device_to_host );
+   check( vecmem::decide_copy( 16, mk::managed, m_a, mk::pinned_host, m_a ),
+          cd::prefetch, ct::device_to_host );
+}
+
+/// Test the copies that need to be performed
+TEST_F( core_copy_decision_test, copies ) {
+
+   // Host to host.
+   check( vecmem::decide_copy( 16, mk::host, m_a, mk::pinned_host, m_b ),
+          cd::host_copy, ct::host_to_host );
+   // Host to/from device, with and without staging.
+   check( vecmem::decide_copy( 16, mk::pinned_host, m_a, mk::device, m_b,
+                               8 ),
+          cd::runtime_copy, ct::host_to_device );
+   check( vecmem::decide_copy( 16, mk::host, m_a, mk::device, m_b ),
+          cd::runtime_copy, ct::host_to_device );
+   check( vecmem::decide_copy( 16, mk::host, m_a, mk::device, m_b, 8 ),
+          cd::staged_copy, ct::host_to_device );
+   check( vecmem::decide_copy( 16, mk::host, m_a, mk::device, m_b, 32 ),
+          cd::runtime_copy, ct::host_to_device );
+   check( vecmem::decide_copy( 16, mk::device, m_a, mk::host, m_b, 8 ),
+          cd::staged_copy, ct::device_to_host );
+   check( vecmem::decide_copy( 16, mk::device, m_a, mk::pinned_host, m_b,
+                               8 ),
+          cd::runtime_copy, ct::device_to_host );
+   check( vecmem::decide_copy( 16, mk::device, m_a, mk::device, m_b ),
+          cd::runtime_copy, ct::device_to_device );
+   // Everything else.
+   check( vecmem::decide_copy( 16, mk::managed, m_a, mk::device, m_b ),
+          cd::runtime_copy, ct::unknown );
+   check( vecmem::decide_copy( 16, mk::host, m_a, mk::shared, m_b ),
+          cd::runtime_copy, ct::unknown );
+   check( vecmem::decide_copy( 16, mk::unknown, m_a, mk::host, m_b ),
+          cd::runtime_copy, ct::unknown );
+}
+
+/// Test @c vecmem::memory_kind_map
+TEST_F( core_copy_decision_test, memory_kind_map ) {
+
+   vecmem::host_memory_resource resource1, resource2;
+   vecmem::memory_kind_map map;
+   EXPECT_EQ( map.get( resource1 ), mk::unknown );
+   map.set( resource1, mk::host );
+   map.set( resource2, mk::device );
+   EXPECT_EQ( map.get( resource1 ), mk::host );
+   EXPECT_EQ( map.get( resource2 ), mk::device );
+   map.set( resource2, mk::managed );
+   EXPECT_EQ( map.get( resource2 ), mk::managed );
+}
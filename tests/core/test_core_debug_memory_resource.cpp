@@ -0,0 +1,111 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/contiguous_memory_resource.hpp"
+#include "vecmem/memory/debug_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+
+/// Test case for @c vecmem::debug_memory_resource
+class core_debug_memory_resource_test : public testing::Test {
+
+protected:
+   /// The upstream memory resource used in the tests
+   vecmem::host_memory_resource m_upstream;
+
+}; // class core_debug_memory_resource_test
+
+/// Test that correctly used memory raises no alarms
+TEST_F( core_debug_memory_resource_test, clean_use ) {
+
+   vecmem::debug_memory_resource resource( m_upstream, 4096, false );
+   for( std::size_t size : { 1ul, 10ul, 1000ul, 5000ul, 100000ul } ) {
+      vecmem::vector< int > vec( size, &resource );
+      std::iota( vec.begin(), vec.end(), 0 );
+      vec.resize( size * 2 );
+   }
+   // The alignment of the small blocks is up to the upstream resource, while
+   // the large blocks are aligned by the debug resource itself.
+   for( std::size_t alignment : { 1ul, 8ul, 16ul, 64ul, 256ul } ) {
+      for( std::size_t size : { 3ul, 5000ul } ) {
+         if( ( size < 4096 ) && ( alignment > alignof( std::max_align_t ) ) ) {
+            continue;
+         }
+         void* ptr = resource.allocate( size, alignment );
+         EXPECT_EQ( reinterpret_cast< std::uintptr_t >( ptr ) % alignment,
+                    0u );
+         std::fill( static_cast< char* >( ptr ),
+                    static_cast< char* >( ptr ) + size, 'a' );
+         resource.deallocate( ptr, size, alignment );
+      }
+   }
+   EXPECT_EQ( resource.corruptions(), 0u );
+}
+
+/// Test the detection of small overruns with the canaries
+TEST_F( core_debug_memory_resource_test, canaries ) {
+
+   vecmem::debug_memory_resource resource( m_upstream, 4096, false );
+
+   char* ptr = static_cast< char* >( resource.allocate( 100 ) );
+   ptr[ 100 ] = 'x';
+   resource.deallocate( ptr, 100 );
+   EXPECT_EQ( resource.corruptions(), 1u );
+
+   ptr = static_cast< char* >( resource.allocate( 100 ) );
+   ptr[ -1 ] = 'x';
+   resource.deallocate( ptr, 100 );
+   EXPECT_EQ( resource.corruptions(), 2u );
+}
+
+/// Test that corruptions abort the application by default
+TEST_F( core_debug_memory_resource_test, abort_on_corruption ) {
+
+   vecmem::debug_memory_resource resource( m_upstream );
+   EXPECT_DEATH( {
+      char* ptr = static_cast< char* >( resource.allocate( 20 ) );
+      ptr[ 20 ] = 'x';
+      resource.deallocate( ptr, 20 );
+   }, "written out of bounds" );
+}
+
+/// Test the guard pages of large allocations
+TEST_F( core_debug_memory_resource_test, guard_pages ) {
+
+   vecmem::debug_memory_resource resource( m_upstream, 4096 );
+   EXPECT_DEATH( {
+      volatile char* ptr =
+         static_cast< volatile char* >( resource.allocate( 10000, 1 ) );
+      ptr[ 10000 ] = 'x';
+   }, "" );
+}
+
+/// Test the filling of freed memory
+TEST_F( core_debug_memory_resource_test, freed_pattern ) {
+
+   // Use an upstream resource that does not really free the memory, so that
+   // it could be looked at after the deallocation.
+   vecmem::contiguous_memory_resource upstream( m_upstream, 100000 );
+   vecmem::debug_memory_resource resource( upstream, 0 );
+
+   unsigned char* ptr =
+      static_cast< unsigned char* >( resource.allocate( 50 ) );
+   std::fill( ptr, ptr + 50, 'a' );
+   resource.deallocate( ptr, 50 );
+   for( std::size_t i = 0; i < 50; ++i ) {
+      EXPECT_EQ( ptr[ i ], vecmem::debug_memory_resource::freed_pattern );
+   }
+}
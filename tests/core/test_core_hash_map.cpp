@@ -0,0 +1,109 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/device_hash_map.hpp"
+#include "vecmem/containers/hash_map.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+/// Test case for @c vecmem::hash_map and @c vecmem::device_hash_map
+class core_hash_map_test : public testing::Test {
+
+protected:
+   /// Memory resource used in the tests
+   vecmem::host_memory_resource m_resource;
+
+}; // class core_hash_map_test
+
+/// Test the basic functionality of the host type
+TEST_F( core_hash_map_test, host ) {
+
+   // The capacity needs to be rounded up to the next power of 2.
+   vecmem::hash_map< unsigned int, std::pair< int, int > > map( 100,
+                                                                m_resource );
+   EXPECT_EQ( map.capacity(), 128u );
+   EXPECT_TRUE( map.empty() );
+
+   // Fill the map with some values.
+   for( unsigned int i = 0; i < 50; ++i ) {
+      EXPECT_TRUE( map.insert( i * 1000, { i, i + 1 } ) );
+   }
+   EXPECT_FALSE( map.insert( 0, { -1, -1 } ) );
+   EXPECT_EQ( map.size(), 50u );
+
+   // Look up the values.
+   for( unsigned int i = 0; i < 50; ++i ) {
+      ASSERT_TRUE( map.contains( i * 1000 ) );
+      EXPECT_EQ( map.at( i * 1000 ).first, static_cast< int >( i ) );
+      EXPECT_EQ( map.find( i * 1000 )->second, static_cast< int >( i + 1 ) );
+   }
+   EXPECT_FALSE( map.contains( 1 ) );
+   EXPECT_FALSE( map.contains( static_cast< unsigned int >( -1 ) ) );
+   EXPECT_EQ( map.find( 1 ), nullptr );
+   EXPECT_THROW( map.at( 1 ), std::out_of_range );
+
+   // Clear the map.
+   map.clear();
+   EXPECT_TRUE( map.empty() );
+   EXPECT_FALSE( map.contains( 0 ) );
+}
+
+/// Test filling up the map completely
+TEST_F( core_hash_map_test, full ) {
+
+   vecmem::hash_map< long, int > map( 16, m_resource );
+   for( long i = 0; i < 16; ++i ) {
+      EXPECT_TRUE( map.insert( -i * 7, static_cast< int >( i ) ) );
+   }
+   EXPECT_FALSE( map.insert( 1, 1 ) );
+   EXPECT_EQ( map.size(), 16u );
+   for( long i = 0; i < 16; ++i ) {
+      EXPECT_EQ( map.at( -i * 7 ), static_cast< int >( i ) );
+   }
+   EXPECT_FALSE( map.contains( 1 ) );
+}
+
+/// Test filling the map from multiple threads, through its view
+TEST_F( core_hash_map_test, concurrent_insert ) {
+
+   // Every key is inserted by multiple threads.
+   static constexpr std::size_t KEYS = 10000;
+   vecmem::hash_map< std::size_t, std::size_t > map( 2 * KEYS, m_resource );
+   const vecmem::data::hash_map_view< std::size_t, std::size_t > view =
+      vecmem::get_data( map );
+   std::atomic< std::size_t > inserted( 0 );
+   vecmem::thread_pool pool( 4 );
+   pool.parallel_for( 4 * KEYS, [ &view, &inserted ]( std::size_t begin,
+                                                      std::size_t end ) {
+      vecmem::device_hash_map< std::size_t, std::size_t > device( view );
+      for( std::size_t i = begin; i < end; ++i ) {
+         if( device.insert( i % KEYS, 2 * ( i % KEYS ) ) ) {
+            ++inserted;
+         }
+      }
+   }, 100 );
+
+   // Check the result.
+   EXPECT_EQ( inserted.load(), KEYS );
+   EXPECT_EQ( map.size(), KEYS );
+   const vecmem::device_hash_map< std::size_t, std::size_t > device( view );
+   for( std::size_t i = 0; i < KEYS; ++i ) {
+      const std::size_t* value = device.find( i );
+      ASSERT_NE( value, nullptr );
+      EXPECT_EQ( *value, 2 * i );
+   }
+}
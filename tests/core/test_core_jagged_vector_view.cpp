@@ -101,3 +101,47 @@ TEST_F(core_jagged_vector_view_test, mutate) {
     EXPECT_EQ(m_jag.at(2, 2), 2 * 9);
     EXPECT_EQ(m_jag.at(2, 3), 2 * 10);
 }
+
+TEST_F(core_jagged_vector_view_test, external_storage) {
+    /*
+     * Re-use the same view array for two different jagged vectors.
+     */
+    vecmem::vector<vecmem::data::vector_view<int>> storage(10, &m_mem);
+    {
+        vecmem::data::jagged_vector_data<int> data(
+            m_vec, vecmem::get_data(storage));
+        EXPECT_EQ(data.m_ptr, storage.data());
+        vecmem::jagged_device_vector<int> jag(data);
+        EXPECT_EQ(jag.size(), 6);
+        EXPECT_EQ(jag.at(5, 4), 16);
+    }
+
+    vecmem::jagged_vector<int> other({
+        vecmem::vector<int>({17, 18}, &m_mem),
+        vecmem::vector<int>({19}, &m_mem)
+    }, &m_mem);
+    vecmem::data::jagged_vector_data<int> data(
+        other, vecmem::get_data(storage));
+    EXPECT_EQ(data.m_ptr, storage.data());
+    vecmem::jagged_device_vector<int> jag(data);
+    EXPECT_EQ(jag.size(), 2);
+    EXPECT_EQ(jag.at(0).size(), 2);
+    EXPECT_EQ(jag.at(1, 0), 19);
+}
+
+TEST_F(core_jagged_vector_view_test, large) {
+    /*
+     * Create a jagged vector with very many rows.
+     */
+    vecmem::jagged_vector<int> large(&m_mem);
+    for (std::size_t i = 0; i < 100000; ++i) {
+        large.push_back(vecmem::vector<int>(i % 3, static_cast<int>(i),
+                                            &m_mem));
+    }
+    vecmem::data::jagged_vector_data<int> data(large);
+    ASSERT_EQ(data.m_size, large.size());
+    for (std::size_t i = 0; i < large.size(); ++i) {
+        ASSERT_EQ(data.m_ptr[i].m_size, large[i].size());
+        ASSERT_EQ(data.m_ptr[i].m_ptr, large[i].data());
+    }
+}
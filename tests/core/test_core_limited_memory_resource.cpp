@@ -0,0 +1,119 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/binary_page_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/limited_memory_resource.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <new>
+#include <thread>
+#include <vector>
+
+/// Test case for @c vecmem::limited_memory_resource
+class core_limited_memory_resource_test : public testing::Test {
+
+protected:
+   /// The upstream memory resource used in the tests
+   vecmem::host_memory_resource m_upstream;
+
+}; // class core_limited_memory_resource_test
+
+/// Test the accounting and the hard limit
+TEST_F( core_limited_memory_resource_test, hard_limit ) {
+
+   vecmem::limited_memory_resource resource( m_upstream, 1000 );
+   EXPECT_EQ( resource.hard_limit(), 1000u );
+   EXPECT_EQ( resource.soft_limit(), 1000u );
+
+   void* ptr1 = resource.allocate( 600 );
+   EXPECT_EQ( resource.used(), 600u );
+   EXPECT_THROW( static_cast< void >( resource.allocate( 500 ) ),
+                 std::bad_alloc );
+   EXPECT_EQ( resource.used(), 600u );
+   void* ptr2 = resource.allocate( 400 );
+   EXPECT_EQ( resource.used(), 1000u );
+   resource.deallocate( ptr1, 600 );
+   resource.deallocate( ptr2, 400 );
+   EXPECT_EQ( resource.used(), 0u );
+}
+
+/// Test the memory pressure callbacks
+TEST_F( core_limited_memory_resource_test, callbacks ) {
+
+   vecmem::limited_memory_resource resource( m_upstream, 1000, 500 );
+   int calls = 0;
+   resource.add_callback( [ &calls ]() { ++calls; } );
+
+   // Staying below the soft limit should not trigger the callbacks.
+   void* ptr1 = resource.allocate( 400 );
+   EXPECT_EQ( calls, 0 );
+   // Crossing it should.
+   void* ptr2 = resource.allocate( 200 );
+   EXPECT_EQ( calls, 1 );
+   // Staying above it should not.
+   void* ptr3 = resource.allocate( 100 );
+   EXPECT_EQ( calls, 1 );
+   // Hitting the hard limit should trigger them again.
+   EXPECT_THROW( static_cast< void >( resource.allocate( 400 ) ),
+                 std::bad_alloc );
+   EXPECT_EQ( calls, 2 );
+
+   resource.deallocate( ptr1, 400 );
+   resource.deallocate( ptr2, 200 );
+   resource.deallocate( ptr3, 100 );
+}
+
+/// Test trimming a binary page resource from a memory pressure callback
+TEST_F( core_limited_memory_resource_test, trim_binary_pages ) {
+
+   vecmem::limited_memory_resource limited( m_upstream, 3000000 );
+   vecmem::binary_page_memory_resource pages( limited );
+   limited.add_callback( [ &pages ]() { pages.trim(); } );
+
+   // Make the binary page resource allocate two root pages, then release
+   // all memory in them.
+   {
+      vecmem::vector< char > vec1( 400000, &pages );
+      vecmem::vector< char > vec2( 400000, &pages );
+      vecmem::vector< char > vec3( 400000, &pages );
+   }
+   EXPECT_EQ( limited.used(), 2097152u );
+
+   // A large allocation should only succeed after the callback gave the
+   // unused root pages back.
+   void* ptr = limited.allocate( 2000000 );
+   EXPECT_EQ( limited.used(), 2000000u );
+   limited.deallocate( ptr, 2000000 );
+
+   // Trimming a resource with no unused pages should not do anything.
+   EXPECT_EQ( pages.trim(), 0u );
+}
+
+/// Test the accounting from multiple threads
+TEST_F( core_limited_memory_resource_test, threads ) {
+
+   vecmem::limited_memory_resource resource( m_upstream, 100000 );
+   std::vector< std::thread > threads;
+   for( int i = 0; i < 4; ++i ) {
+      threads.emplace_back( [ &resource ]() {
+         for( int j = 0; j < 1000; ++j ) {
+            vecmem::vector< int > vec( 100, &resource );
+            EXPECT_LE( resource.used(), resource.hard_limit() );
+         }
+      } );
+   }
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+   EXPECT_EQ( resource.used(), 0u );
+}
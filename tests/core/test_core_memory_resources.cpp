@@ -18,6 +18,7 @@
 // System include(s).
 #include <algorithm>
 #include <cmath>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -113,16 +114,59 @@ TEST_P( core_memory_resource_test, custom_value ) {
 
 // Memory resources to use in the test.
 static vecmem::host_memory_resource host_resource;
+static vecmem::host_memory_resource uncached_host_resource( false );
 static vecmem::binary_page_memory_resource binary_resource( host_resource );
 static vecmem::contiguous_memory_resource contiguous_resource( host_resource,
                                                                20000 );
 
 // Instantiate the test suite.
 INSTANTIATE_TEST_SUITE_P( core_memory_resource_tests, core_memory_resource_test,
-                          testing::Values( &host_resource, &binary_resource,
+                          testing::Values( &host_resource,
+                                           &uncached_host_resource,
+                                           &binary_resource,
                                            &contiguous_resource ),
                           vecmem::testing::memory_resource_name_gen(
                              { { &host_resource, "host_resource" },
+                               { &uncached_host_resource,
+                                 "uncached_host_resource" },
                                { &binary_resource, "binary_resource" },
                                { &contiguous_resource, "contiguous_resource" } }
                           ) );
+
+/// Test the thread-local cache of the host memory resource
+TEST( core_host_memory_resource_test, cache ) {
+
+   vecmem::host_memory_resource cached, uncached( false );
+   EXPECT_TRUE( cached.uses_cache() );
+   EXPECT_FALSE( uncached.uses_cache() );
+   EXPECT_TRUE( cached.is_equal( vecmem::host_memory_resource() ) );
+   EXPECT_FALSE( cached.is_equal( uncached ) );
+
+   // A freed small block should be re-used for a request of the same size
+   // class.
+   void* ptr1 = cached.allocate( 20 );
+   cached.deallocate( ptr1, 20 );
+   void* ptr2 = cached.allocate( 32 );
+   EXPECT_EQ( ptr1, ptr2 );
+   // The full size of the size class should be usable.
+   std::fill( static_cast< char* >( ptr2 ), static_cast< char* >( ptr2 ) + 32,
+              'a' );
+   cached.deallocate( ptr2, 32 );
+
+   // Blocks freed on other threads, and threads exiting with blocks in
+   // their caches, should be handled correctly.
+   void* ptr3 = cached.allocate( 100 );
+   std::thread( [ & ]() { cached.deallocate( ptr3, 100 ); } ).join();
+   void* ptr4 = cached.allocate( 100 );
+   std::thread( [ & ]() {
+      void* ptr5 = cached.allocate( 100 );
+      cached.deallocate( ptr5, 100 );
+   } ).join();
+   cached.deallocate( ptr4, 100 );
+
+   // Large allocations should not be affected.
+   void* ptr6 = cached.allocate( 100000 );
+   std::fill( static_cast< char* >( ptr6 ),
+              static_cast< char* >( ptr6 ) + 100000, 'b' );
+   cached.deallocate( ptr6, 100000 );
+}
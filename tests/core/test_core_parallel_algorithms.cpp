@@ -0,0 +1,303 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/jagged_vector_data.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/parallel_algorithms.hpp"
+#include "vecmem/utils/thread_pool.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+
+/// Test case for the parallel algorithms
+class core_parallel_algorithms_test : public testing::Test {
+
+protected:
+   /// Set up the test data
+   void SetUp() override {
+
+      // The vector is large enough to be split into multiple chunks.
+      for( std::size_t i = 0; i < m_vector.size(); ++i ) {
+         m_vector[ i ] = static_cast< int >( ( i * 7919 ) % 1000 );
+      }
+      // The jagged vector has very unevenly sized rows, and some empty ones.
+      for( std::size_t i = 0; i < 100; ++i ) {
+         const std::size_t size = ( ( i % 10 == 0 ) ? 20000 :
+                                    ( i % 3 == 0 ) ? 0 : i );
+         m_jagged.push_back(
+            vecmem::vector< int >( size, static_cast< int >( i ),
+                                   &m_resource ) );
+      }
+   }
+
+   /// Memory resource used in the tests
+   vecmem::host_memory_resource m_resource;
+   /// Thread pool used in the tests
+   vecmem::thread_pool m_pool{ 4 };
+   /// 1-dimensional test vector
+   vecmem::vector< int > m_vector{ 100000, &m_resource };
+   /// Jagged test vector
+   vecmem::jagged_vector< int > m_jagged{ &m_resource };
+
+}; // class core_parallel_algorithms_test
+
+/// Test @c vecmem::thread_pool::parallel_for
+TEST_F( core_parallel_algorithms_test, parallel_for ) {
+
+   // Check that every index is visited exactly once, even when the loops
+   // are nested.
+   std::vector< std::atomic< int > > visits( 1000 );
+   m_pool.parallel_for( 10, [ this, &visits ]( std::size_t begin,
+                                               std::size_t end ) {
+      for( std::size_t i = begin; i < end; ++i ) {
+         m_pool.parallel_for( 100, [ i, &visits ]( std::size_t b,
+                                                   std::size_t e ) {
+            for( std::size_t j = b; j < e; ++j ) {
+               ++visits[ i * 100 + j ];
+            }
+         }, 7 );
+      }
+   }, 1 );
+   for( const std::atomic< int >& v : visits ) {
+      EXPECT_EQ( v.load(), 1 );
+   }
+
+   // Check that exceptions are propagated to the caller.
+   EXPECT_THROW( m_pool.parallel_for( 100, []( std::size_t begin,
+                                               std::size_t ) {
+                    if( begin == 50 ) {
+                       throw std::runtime_error( "test" );
+                    }
+                 }, 10 ),
+                 std::runtime_error );
+}
+
+/// Test @c vecmem::parallel::for_each and @c vecmem::parallel::transform
+TEST_F( core_parallel_algorithms_test, for_each_transform ) {
+
+   // 1-dimensional vectors.
+   vecmem::vector< int > reference = m_vector;
+   vecmem::parallel::for_each( vecmem::get_data( m_vector ),
+                               []( int& i ) { i *= 2; }, m_pool );
+   vecmem::vector< long > output( m_vector.size(), &m_resource );
+   vecmem::parallel::transform( vecmem::get_data( m_vector ),
+                                vecmem::get_data( output ),
+                                []( int i ) { return i + 1l; }, m_pool );
+   for( std::size_t i = 0; i < reference.size(); ++i ) {
+      EXPECT_EQ( m_vector[ i ], reference[ i ] * 2 );
+      EXPECT_EQ( output[ i ], reference[ i ] * 2 + 1 );
+   }
+
+   // Jagged vectors.
+   vecmem::jagged_vector< int > jagged_output = m_jagged;
+   vecmem::data::jagged_vector_data< int > data( m_jagged );
+   vecmem::data::jagged_vector_data< int > output_data( jagged_output );
+   vecmem::parallel::for_each( data, []( int& i ) { i += 1; }, m_pool );
+   vecmem::parallel::transform( data, output_data,
+                                []( int i ) { return -i; }, m_pool );
+   for( std::size_t i = 0; i < m_jagged.size(); ++i ) {
+      for( std::size_t j = 0; j < m_jagged[ i ].size(); ++j ) {
+         EXPECT_EQ( m_jagged[ i ][ j ], static_cast< int >( i ) + 1 );
+         EXPECT_EQ( jagged_output[ i ][ j ], -static_cast< int >( i ) - 1 );
+      }
+   }
+}
+
+/// Test @c vecmem::parallel::reduce
+TEST_F( core_parallel_algorithms_test, reduce ) {
+
+   EXPECT_EQ( vecmem::parallel::reduce( vecmem::get_data( m_vector ), 10l,
+                                        std::plus<>(), m_pool ),
+              std::accumulate( m_vector.begin(), m_vector.end(), 10l ) );
+   EXPECT_EQ( vecmem::parallel::reduce( vecmem::get_data( m_vector ),
+                                        -1, []( int a, int b ) {
+                                           return std::max( a, b ); },
+                                        m_pool ),
+              999 );
+
+   long reference = 0;
+   for( const vecmem::vector< int >& row : m_jagged ) {
+      reference = std::accumulate( row.begin(), row.end(), reference );
+   }
+   vecmem::data::jagged_vector_data< int > data( m_jagged );
+   EXPECT_EQ( vecmem::parallel::reduce( data, 0l, std::plus<>(), m_pool ),
+              reference );
+
+   // Empty input.
+   vecmem::vector< int > empty( &m_resource );
+   EXPECT_EQ( vecmem::parallel::reduce( vecmem::get_data( empty ), 5 ), 5 );
+}
+
+/// Test @c vecmem::parallel::inclusive_scan and
+/// @c vecmem::parallel::exclusive_scan
+TEST_F( core_parallel_algorithms_test, scan ) {
+
+   vecmem::vector< long > inclusive( m_vector.size(), &m_resource );
+   vecmem::vector< long > exclusive( m_vector.size(), &m_resource );
+   vecmem::parallel::inclusive_scan( vecmem::get_data( m_vector ),
+                                     vecmem::get_data( inclusive ),
+                                     std::plus<>(), m_pool );
+   vecmem::parallel::exclusive_scan( vecmem::get_data( m_vector ),
+                                     vecmem::get_data( exclusive ), 5l,
+                                     std::plus<>(), m_pool );
+   long sum = 0;
+   for( std::size_t i = 0; i < m_vector.size(); ++i ) {
+      EXPECT_EQ( exclusive[ i ], sum + 5 );
+      sum += m_vector[ i ];
+      EXPECT_EQ( inclusive[ i ], sum );
+   }
+
+   // In-place scan.
+   vecmem::parallel::inclusive_scan( vecmem::get_data( inclusive ),
+                                     vecmem::get_data( inclusive ),
+                                     std::plus<>(), m_pool );
+   long sum2 = 0;
+   sum = 0;
+   for( std::size_t i = 0; i < m_vector.size(); ++i ) {
+      sum += m_vector[ i ];
+      sum2 += sum;
+      EXPECT_EQ( inclusive[ i ], sum2 );
+   }
+}
+
+/// Test @c vecmem::parallel::copy_if
+TEST_F( core_parallel_algorithms_test, copy_if ) {
+
+   vecmem::vector< int > output( m_vector.size(), &m_resource );
+   auto pred = []( int i ) { return ( i % 3 == 0 ); };
+   const std::size_t count =
+      vecmem::parallel::copy_if( vecmem::get_data( m_vector ),
+                                 vecmem::get_data( output ), pred, m_pool );
+   vecmem::vector< int > reference( &m_resource );
+   std::copy_if( m_vector.begin(), m_vector.end(),
+                 std::back_inserter( reference ), pred );
+   ASSERT_EQ( count, reference.size() );
+   EXPECT_TRUE( std::equal( reference.begin(), reference.end(),
+                            output.begin() ) );
+}
+
+/// Test @c vecmem::parallel::sort
+TEST_F( core_parallel_algorithms_test, sort ) {
+
+   vecmem::vector< int > reference = m_vector;
+   std::sort( reference.begin(), reference.end(), std::greater<>() );
+   vecmem::parallel::sort( vecmem::get_data( m_vector ), std::greater<>(),
+                           m_pool );
+   EXPECT_EQ( m_vector, reference );
+
+   // Sort a vector whose size is not a multiple of the chunk size, with the
+   // default pool.
+   vecmem::vector< int > odd( 12345, &m_resource );
+   for( std::size_t i = 0; i < odd.size(); ++i ) {
+      odd[ i ] = static_cast< int >( ( i * 31 ) % 1001 );
+   }
+   vecmem::parallel::sort( vecmem::get_data( odd ) );
+   EXPECT_TRUE( std::is_sorted( odd.begin(), odd.end() ) );
+}
+
+/// Test @c vecmem::parallel::make_offsets
+TEST_F( core_parallel_algorithms_test, make_offsets ) {
+
+   // Test sizes that are/aren't multiples of the unrolling and the chunks.
+   for( std::size_t size : { 0ul, 1ul, 7ul, 12345ul, 100000ul } ) {
+      vecmem::vector< std::size_t > sizes( size, &m_resource );
+      for( std::size_t i = 0; i < size; ++i ) {
+         sizes[ i ] = ( i * 13 ) % 17;
+      }
+      vecmem::vector< std::size_t > offsets( size + 1, &m_resource );
+      const std::size_t total =
+         vecmem::parallel::make_offsets( vecmem::get_data( sizes ),
+                                         vecmem::get_data( offsets ),
+                                         m_pool );
+      std::size_t reference = 0;
+      for( std::size_t i = 0; i < size; ++i ) {
+         ASSERT_EQ( offsets[ i ], reference );
+         reference += sizes[ i ];
+      }
+      EXPECT_EQ( offsets[ size ], reference );
+      EXPECT_EQ( total, reference );
+
+      // Perform the same scan in-place.
+      sizes.push_back( 0 );
+      vecmem::parallel::make_offsets( { size, sizes.data() },
+                                      vecmem::get_data( sizes ), m_pool );
+      EXPECT_EQ( sizes, offsets );
+   }
+}
+
+/// Test @c vecmem::parallel::make_jagged_vector_buffer
+TEST_F( core_parallel_algorithms_test, make_jagged_vector_buffer ) {
+
+   // Take the row sizes from the jagged test vector.
+   vecmem::vector< std::size_t > sizes( &m_resource );
+   for( const vecmem::vector< int >& row : m_jagged ) {
+      sizes.push_back( row.size() );
+   }
+
+   // Create an unfilled buffer.
+   auto empty = vecmem::parallel::make_jagged_vector_buffer< int >(
+      vecmem::get_data( sizes ), m_resource, m_pool );
+   ASSERT_EQ( empty.m_size, sizes.size() );
+   for( std::size_t i = 0; i < sizes.size(); ++i ) {
+      EXPECT_EQ( empty.m_ptr[ i ].m_size, sizes[ i ] );
+   }
+
+   // Create a filled buffer.
+   auto filled = vecmem::parallel::make_jagged_vector_buffer< int >(
+      vecmem::get_data( sizes ),
+      []( std::size_t row, std::size_t column ) {
+         return static_cast< int >( row * 100000 + column );
+      }, m_resource, m_pool );
+   ASSERT_EQ( filled.m_size, sizes.size() );
+   const int* payload = nullptr;
+   for( std::size_t i = 0; i < sizes.size(); ++i ) {
+      ASSERT_EQ( filled.m_ptr[ i ].m_size, sizes[ i ] );
+      // The rows need to follow each other in memory.
+      if( payload != nullptr ) {
+         EXPECT_EQ( filled.m_ptr[ i ].m_ptr, payload );
+      }
+      payload = filled.m_ptr[ i ].m_ptr + sizes[ i ];
+      for( std::size_t j = 0; j < sizes[ i ]; ++j ) {
+         EXPECT_EQ( filled.m_ptr[ i ].m_ptr[ j ],
+                    static_cast< int >( i * 100000 + j ) );
+      }
+   }
+}
+
+/// Test @c vecmem::parallel::make_jagged_vector_view
+TEST_F( core_parallel_algorithms_test, make_jagged_vector_view ) {
+
+   // Create a jagged vector with enough rows to be split into multiple chunks.
+   vecmem::jagged_vector< int > large( &m_resource );
+   for( std::size_t i = 0; i < 10000; ++i ) {
+      large.push_back( vecmem::vector< int >( i % 3, static_cast< int >( i ),
+                                              &m_resource ) );
+   }
+
+   // Set up its views in parallel.
+   vecmem::vector< vecmem::data::vector_view< int > >
+      storage( large.size(), &m_resource );
+   vecmem::data::jagged_vector_view< int > view =
+      vecmem::parallel::make_jagged_vector_view(
+         large, vecmem::get_data( storage ), m_pool );
+   ASSERT_EQ( view.m_size, large.size() );
+   EXPECT_EQ( view.m_ptr, storage.data() );
+   for( std::size_t i = 0; i < large.size(); ++i ) {
+      ASSERT_EQ( view.m_ptr[ i ].m_size, large[ i ].size() );
+      ASSERT_EQ( view.m_ptr[ i ].m_ptr, large[ i ].data() );
+   }
+}
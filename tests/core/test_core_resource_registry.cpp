@@ -0,0 +1,134 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/binary_page_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/resource_registry.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/// Test case for @c vecmem::resource_registry
+class core_resource_registry_test : public testing::Test {
+
+protected:
+   /// Set up a factory counting the resources created through it
+   void SetUp() override {
+      m_registry.set_factory( vecmem::memory_kind::host,
+                              [ this ]( int device ) {
+                                 ++m_created;
+                                 std::lock_guard< std::mutex >
+                                    lock( m_mutex );
+                                 m_devices.push_back( device );
+                                 return std::make_unique<
+                                    vecmem::host_memory_resource >();
+                              } );
+   }
+
+   /// The registry being tested
+   vecmem::resource_registry m_registry;
+   /// The number of resources created by the factory
+   std::atomic< int > m_created{ 0 };
+   /// Mutex guarding the device list
+   std::mutex m_mutex;
+   /// The devices that the factory was called for
+   std::vector< int > m_devices;
+
+}; // class core_resource_registry_test
+
+/// Test the caching of the resources
+TEST_F( core_resource_registry_test, caching ) {
+
+   vecmem::memory_resource& r1 =
+      m_registry.get( 0, vecmem::memory_kind::host );
+   vecmem::memory_resource& r2 =
+      m_registry.get( 0, vecmem::memory_kind::host );
+   vecmem::memory_resource& r3 =
+      m_registry.get( 3, vecmem::memory_kind::host );
+   EXPECT_EQ( &r1, &r2 );
+   EXPECT_NE( &r1, &r3 );
+   EXPECT_EQ( m_created.load(), 2 );
+   EXPECT_EQ( m_devices, std::vector< int >( { 0, 3 } ) );
+
+   // The resources should be usable.
+   void* ptr = r3.allocate( 100 );
+   EXPECT_NE( ptr, nullptr );
+   r3.deallocate( ptr, 100 );
+}
+
+/// Test the error handling of the registry
+TEST_F( core_resource_registry_test, errors ) {
+
+   EXPECT_THROW( m_registry.get( -1, vecmem::memory_kind::host ),
+                 std::out_of_range );
+   EXPECT_THROW( m_registry.get( vecmem::resource_registry::max_devices,
+                                 vecmem::memory_kind::host ),
+                 std::out_of_range );
+   EXPECT_THROW( m_registry.get( 0, vecmem::memory_kind::device ),
+                 std::runtime_error );
+   m_registry.set_factory( vecmem::memory_kind::device,
+                           []( int ) {
+                              return std::unique_ptr<
+                                 vecmem::memory_resource >();
+                           } );
+   EXPECT_THROW( m_registry.get( 0, vecmem::memory_kind::device ),
+                 std::runtime_error );
+}
+
+/// Test accessing the registry from multiple threads
+TEST_F( core_resource_registry_test, threads ) {
+
+   static constexpr std::size_t N_THREADS = 8;
+   std::vector< vecmem::memory_resource* > results( N_THREADS, nullptr );
+   std::vector< std::thread > threads;
+   for( std::size_t i = 0; i < N_THREADS; ++i ) {
+      threads.emplace_back( [ this, i, &results ]() {
+         for( int j = 0; j < 1000; ++j ) {
+            results[ i ] = &( m_registry.get( 1,
+                                              vecmem::memory_kind::host ) );
+         }
+      } );
+   }
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+   // The factory may have been called concurrently, but only one resource
+   // may have been handed out.
+   EXPECT_GE( m_created.load(), 1 );
+   for( vecmem::memory_resource* result : results ) {
+      EXPECT_EQ( result, results.front() );
+   }
+}
+
+/// Test building resources on top of other resources of the registry
+TEST_F( core_resource_registry_test, layered ) {
+
+   m_registry.set_factory( vecmem::memory_kind::device,
+                           [ this ]( int device ) {
+                              return std::make_unique<
+                                 vecmem::binary_page_memory_resource >(
+                                    m_registry.get(
+                                       device, vecmem::memory_kind::host ) );
+                           } );
+   vecmem::memory_resource& pool =
+      m_registry.get( 2, vecmem::memory_kind::device );
+   EXPECT_EQ( &pool, &( m_registry.get( 2, vecmem::memory_kind::device ) ) );
+   EXPECT_EQ( m_devices, std::vector< int >( { 2 } ) );
+
+   void* ptr = pool.allocate( 100 );
+   EXPECT_NE( ptr, nullptr );
+   pool.deallocate( ptr, 100 );
+}
@@ -0,0 +1,123 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/vector_view.hpp"
+#include "vecmem/containers/device_ring_buffer.hpp"
+#include "vecmem/containers/ring_buffer.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/// Test case for @c vecmem::ring_buffer and @c vecmem::device_ring_buffer
+class core_ring_buffer_test : public testing::Test {
+
+protected:
+   /// Memory resource used in the tests
+   vecmem::host_memory_resource m_resource;
+
+}; // class core_ring_buffer_test
+
+/// Test the buffer from a single thread
+TEST_F( core_ring_buffer_test, single_thread ) {
+
+   vecmem::ring_buffer< int > buffer( 5, m_resource );
+   EXPECT_EQ( buffer.capacity(), 8u );
+   EXPECT_TRUE( buffer.empty() );
+
+   // Go around the buffer a few times.
+   int value = 0;
+   for( int round = 0; round < 3; ++round ) {
+      for( int i = 0; i < 8; ++i ) {
+         EXPECT_TRUE( buffer.try_push( round * 10 + i ) );
+      }
+      EXPECT_FALSE( buffer.try_push( -1 ) );
+      EXPECT_EQ( buffer.size(), 8u );
+      for( int i = 0; i < 8; ++i ) {
+         ASSERT_TRUE( buffer.try_pop( value ) );
+         EXPECT_EQ( value, round * 10 + i );
+      }
+      EXPECT_FALSE( buffer.try_pop( value ) );
+      EXPECT_TRUE( buffer.empty() );
+   }
+}
+
+/// Test the smallest possible buffers
+TEST_F( core_ring_buffer_test, minimal_capacity ) {
+
+   for( std::size_t capacity : { 0u, 1u } ) {
+      vecmem::ring_buffer< int > buffer( capacity, m_resource );
+      EXPECT_EQ( buffer.capacity(), 2u );
+
+      // Unconsumed elements must not be overwritten.
+      EXPECT_TRUE( buffer.try_push( 1 ) );
+      EXPECT_TRUE( buffer.try_push( 2 ) );
+      EXPECT_FALSE( buffer.try_push( 3 ) );
+      int value = 0;
+      ASSERT_TRUE( buffer.try_pop( value ) );
+      EXPECT_EQ( value, 1 );
+      ASSERT_TRUE( buffer.try_pop( value ) );
+      EXPECT_EQ( value, 2 );
+      EXPECT_FALSE( buffer.try_pop( value ) );
+   }
+}
+
+/// Test passing views between multiple producers and consumers
+TEST_F( core_ring_buffer_test, multiple_threads ) {
+
+   // Every producer pushes views with different sizes.
+   static constexpr std::size_t PRODUCERS = 3;
+   static constexpr std::size_t CONSUMERS = 3;
+   static constexpr std::size_t ELEMENTS = 10000;
+   typedef vecmem::data::vector_view< int > view_type;
+   vecmem::ring_buffer< view_type > buffer( 16, m_resource );
+   const vecmem::data::ring_buffer_view< view_type > data =
+      vecmem::get_data( buffer );
+
+   // Start all producers and consumers.
+   std::vector< std::thread > threads;
+   std::vector< std::vector< std::size_t > > received(
+      CONSUMERS, std::vector< std::size_t >( PRODUCERS, 0 ) );
+   for( std::size_t p = 0; p < PRODUCERS; ++p ) {
+      threads.emplace_back( [ &buffer, p ]() {
+         for( std::size_t i = 0; i < ELEMENTS; ++i ) {
+            buffer.push( view_type( p, nullptr ) );
+         }
+      } );
+   }
+   for( std::size_t c = 0; c < CONSUMERS; ++c ) {
+      threads.emplace_back( [ &data, &received, c ]() {
+         vecmem::device_ring_buffer< view_type > device( data );
+         view_type view;
+         for( std::size_t i = 0; i < ELEMENTS; ++i ) {
+            while( ! device.try_pop( view ) ) {
+               std::this_thread::yield();
+            }
+            ++( received[ c ][ view.m_size ] );
+         }
+      } );
+   }
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+
+   // Check that every element was received exactly once.
+   for( std::size_t p = 0; p < PRODUCERS; ++p ) {
+      std::size_t sum = 0;
+      for( std::size_t c = 0; c < CONSUMERS; ++c ) {
+         sum += received[ c ][ p ];
+      }
+      EXPECT_EQ( sum, ELEMENTS );
+   }
+   EXPECT_TRUE( buffer.empty() );
+}
@@ -0,0 +1,74 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/device_search_table.hpp"
+#include "vecmem/containers/search_table.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+
+/// Test case for @c vecmem::search_table
+class core_search_table_test : public testing::Test {
+
+protected:
+   /// Memory resource used in the tests
+   vecmem::host_memory_resource m_resource;
+
+}; // class core_search_table_test
+
+/// Compare the lookups with @c std::lower_bound, for tables of all shapes
+TEST_F( core_search_table_test, lower_bound ) {
+
+   for( std::size_t size : { 0, 1, 2, 3, 7, 8, 9, 100, 1023, 1024, 1025 } ) {
+
+      // Create a sorted vector with some duplicates, and gaps between the
+      // values.
+      vecmem::vector< int > sorted( size, &m_resource );
+      for( std::size_t i = 0; i < size; ++i ) {
+         sorted[ i ] = static_cast< int >( ( i / 2 ) * 4 + ( i % 2 ) );
+      }
+      const vecmem::search_table< int > table( vecmem::get_data( sorted ),
+                                               m_resource );
+      EXPECT_EQ( table.size(), size );
+      EXPECT_EQ( table.empty(), size == 0 );
+
+      // Check all values in (and a bit outside of) the range of the table.
+      const int max = ( size == 0 ? 0 : sorted.back() ) + 2;
+      for( int value = -2; value <= max; ++value ) {
+         const std::size_t reference =
+            std::lower_bound( sorted.begin(), sorted.end(), value ) -
+            sorted.begin();
+         ASSERT_EQ( table.lower_bound( value ), reference );
+         const bool found = ( ( reference != size ) &&
+                              ( sorted[ reference ] == value ) );
+         ASSERT_EQ( table.find( value ), found ? reference : size );
+      }
+   }
+}
+
+/// Test using the table through its view
+TEST_F( core_search_table_test, device ) {
+
+   vecmem::vector< double > sorted( { 1.0, 2.5, 3.0, 10.0 }, &m_resource );
+   const vecmem::search_table< double > table( vecmem::get_data( sorted ),
+                                               m_resource );
+   const vecmem::device_search_table< double >
+      device( vecmem::get_data( table ) );
+   EXPECT_EQ( device.size(), 4u );
+   EXPECT_EQ( device.lower_bound( 0.5 ), 0u );
+   EXPECT_EQ( device.lower_bound( 2.6 ), 2u );
+   EXPECT_EQ( device.lower_bound( 11.0 ), 4u );
+   EXPECT_EQ( device.find( 10.0 ), 3u );
+   EXPECT_EQ( device.find( 2.6 ), 4u );
+}
@@ -0,0 +1,181 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/small_vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+   /// Memory resource counting the allocations made through it
+   class counting_resource : public vecmem::memory_resource {
+
+   public:
+      /// The number of allocations made
+      std::size_t m_allocations = 0;
+      /// The number of deallocations made
+      std::size_t m_deallocations = 0;
+
+   private:
+      void* do_allocate( std::size_t size, std::size_t alignment ) override {
+         ++m_allocations;
+         return m_upstream.allocate( size, alignment );
+      }
+      void do_deallocate( void* ptr, std::size_t size,
+                          std::size_t alignment ) override {
+         ++m_deallocations;
+         m_upstream.deallocate( ptr, size, alignment );
+      }
+      bool do_is_equal( const vecmem::memory_resource& other ) const
+         noexcept override {
+         return ( this == &other );
+      }
+
+      /// The resource performing the actual allocations
+      vecmem::host_memory_resource m_upstream;
+
+   }; // class counting_resource
+
+} // private namespace
+
+/// Test case for @c vecmem::small_vector
+class core_small_vector_test : public testing::Test {
+
+protected:
+   /// Memory resource used in the tests
+   counting_resource m_resource;
+
+}; // class core_small_vector_test
+
+/// Test that small vectors do not allocate any memory
+TEST_F( core_small_vector_test, inline_storage ) {
+
+   {
+      vecmem::small_vector< int, 8 > vec( &m_resource );
+      for( int i = 0; i < 8; ++i ) {
+         vec.push_back( i );
+      }
+      EXPECT_TRUE( vec.is_inline() );
+      EXPECT_EQ( vec.size(), 8u );
+      EXPECT_EQ( vec.capacity(), 8u );
+      EXPECT_EQ( vec.front(), 0 );
+      EXPECT_EQ( vec.back(), 7 );
+      EXPECT_THROW( vec.at( 8 ), std::out_of_range );
+   }
+   EXPECT_EQ( m_resource.m_allocations, 0u );
+}
+
+/// Test growing past the inline storage
+TEST_F( core_small_vector_test, spill ) {
+
+   {
+      vecmem::small_vector< int, 4 > vec( &m_resource );
+      for( int i = 0; i < 100; ++i ) {
+         vec.push_back( i );
+      }
+      EXPECT_FALSE( vec.is_inline() );
+      EXPECT_EQ( vec.size(), 100u );
+      EXPECT_GE( vec.capacity(), 100u );
+      for( int i = 0; i < 100; ++i ) {
+         EXPECT_EQ( vec[ i ], i );
+      }
+      EXPECT_GT( m_resource.m_allocations, 0u );
+
+      // Pushing back one of the vector's own elements during a reallocation.
+      vecmem::small_vector< int, 2 > vec2( { 5, 6 }, &m_resource );
+      vec2.push_back( vec2[ 0 ] );
+      EXPECT_EQ( vec2[ 2 ], 5 );
+   }
+   EXPECT_EQ( m_resource.m_allocations, m_resource.m_deallocations );
+}
+
+/// Test copying and moving vectors
+TEST_F( core_small_vector_test, copy_and_move ) {
+
+   {
+      // Test with a non-trivial type, using both inline and heap storage.
+      for( std::size_t size : { 2u, 20u } ) {
+         vecmem::small_vector< std::string, 4 > vec( size, "test",
+                                                     &m_resource );
+         vecmem::small_vector< std::string, 4 > copy( vec );
+         EXPECT_EQ( copy.size(), size );
+         EXPECT_TRUE( std::equal( vec.begin(), vec.end(), copy.begin() ) );
+         EXPECT_EQ( copy.resource(), &m_resource );
+
+         vecmem::small_vector< std::string, 4 > moved( std::move( copy ) );
+         EXPECT_TRUE( copy.empty() );
+         EXPECT_TRUE( copy.is_inline() );
+         EXPECT_EQ( moved.size(), size );
+         EXPECT_TRUE( std::equal( vec.begin(), vec.end(), moved.begin() ) );
+
+         vecmem::small_vector< std::string, 4 > assigned( &m_resource );
+         assigned.push_back( "something" );
+         assigned = vec;
+         EXPECT_TRUE( std::equal( vec.begin(), vec.end(),
+                                  assigned.begin() ) );
+         assigned = std::move( moved );
+         EXPECT_TRUE( moved.empty() );
+         EXPECT_EQ( assigned.size(), size );
+         EXPECT_EQ( assigned.back(), "test" );
+      }
+   }
+   EXPECT_EQ( m_resource.m_allocations, m_resource.m_deallocations );
+}
+
+/// Test the element modification functions
+TEST_F( core_small_vector_test, modify ) {
+
+   vecmem::small_vector< int, 4 > vec( { 1, 2, 3 }, &m_resource );
+   vec.insert( vec.begin() + 1, 10 );
+   vec.insert( vec.end(), 20 );
+   vec.insert( vec.begin(), vec.back() );
+   const int ref1[] = { 20, 1, 10, 2, 3, 20 };
+   ASSERT_EQ( vec.size(), 6u );
+   EXPECT_TRUE( std::equal( vec.begin(), vec.end(), ref1 ) );
+
+   vec.erase( vec.begin() );
+   vec.erase( vec.begin() + 1, vec.begin() + 3 );
+   vec.pop_back();
+   const int ref2[] = { 1, 3 };
+   ASSERT_EQ( vec.size(), 2u );
+   EXPECT_TRUE( std::equal( vec.begin(), vec.end(), ref2 ) );
+   EXPECT_EQ( *( vec.rbegin() ), 3 );
+
+   vec.resize( 5, 7 );
+   EXPECT_EQ( vec.size(), 5u );
+   EXPECT_EQ( vec[ 4 ], 7 );
+   vec.resize( 1 );
+   EXPECT_EQ( vec.size(), 1u );
+   vec.clear();
+   EXPECT_TRUE( vec.empty() );
+}
+
+/// Test accessing the vector through a view
+TEST_F( core_small_vector_test, get_data ) {
+
+   vecmem::small_vector< int, 4 > vec( { 1, 2, 3 }, &m_resource );
+   vecmem::device_vector< int > device( vecmem::get_data( vec ) );
+   ASSERT_EQ( device.size(), 3u );
+   device[ 1 ] = 5;
+   EXPECT_EQ( vec[ 1 ], 5 );
+
+   const vecmem::small_vector< int, 4 >& cvec = vec;
+   auto cdata = vecmem::get_data( cvec );
+   EXPECT_EQ( cdata.m_size, 3u );
+   EXPECT_EQ( cdata.m_ptr, vec.data() );
+}
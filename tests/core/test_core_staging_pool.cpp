@@ -0,0 +1,186 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/staging_pool.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+   /// Memory resource counting the allocations made through it
+   class counting_resource : public vecmem::memory_resource {
+
+   public:
+      /// The number of allocations made
+      std::size_t m_allocations = 0;
+
+   private:
+      void* do_allocate( std::size_t size, std::size_t alignment ) override {
+         ++m_allocations;
+         return m_upstream.allocate( size, alignment );
+      }
+      void do_deallocate( void* ptr, std::size_t size,
+                          std::size_t alignment ) override {
+         m_upstream.deallocate( ptr, size, alignment );
+      }
+      bool do_is_equal( const vecmem::memory_resource& other ) const
+         noexcept override {
+         return ( this == &other );
+      }
+
+      /// The resource performing the actual allocations
+      vecmem::host_memory_resource m_upstream;
+
+   }; // class counting_resource
+
+   /// Transfer implementation only performing the copies when waited on
+   ///
+   /// This way any premature re-use of a slot by the pool would show up as
+   /// corrupted data.
+   ///
+   class deferred_transfer : public vecmem::staging_pool::transfer {
+
+   public:
+      /// Constructor with the number of slots
+      deferred_transfer( std::size_t slots ) : m_pending( slots ) {}
+
+      /// Remember the transfer to perform
+      void start( std::size_t slot, std::size_t size, const void* from,
+                  void* to ) override {
+         if( m_starts == m_fail_at ) {
+            throw std::runtime_error( "Failed to start transfer" );
+         }
+         EXPECT_FALSE( m_pending[ slot ].m_active );
+         m_pending[ slot ] = { true, size, from, to };
+         ++m_starts;
+      }
+      /// Perform the remembered transfer
+      void wait( std::size_t slot ) override {
+         pending& p = m_pending[ slot ];
+         if( p.m_active ) {
+            std::memcpy( p.m_to, p.m_from, p.m_size );
+            p.m_active = false;
+         }
+      }
+
+      /// Check whether no transfer is pending anymore
+      bool idle() const {
+         for( const pending& p : m_pending ) {
+            if( p.m_active ) {
+               return false;
+            }
+         }
+         return true;
+      }
+
+      /// The number of transfers started
+      std::size_t m_starts = 0;
+      /// The number of transfers to start successfully before failing
+      std::size_t m_fail_at = static_cast< std::size_t >( -1 );
+
+   private:
+      /// Description of a pending transfer
+      struct pending {
+         bool m_active = false;
+         std::size_t m_size = 0;
+         const void* m_from = nullptr;
+         void* m_to = nullptr;
+      };
+      /// The pending transfers of the slots
+      std::vector< pending > m_pending;
+
+   }; // class deferred_transfer
+
+} // private namespace
+
+/// Test case for @c vecmem::staging_pool
+class core_staging_pool_test : public testing::Test {
+
+protected:
+   /// Memory resource used in the tests
+   counting_resource m_resource;
+
+}; // class core_staging_pool_test
+
+/// Test round-trips of different sizes through the pool
+TEST_F( core_staging_pool_test, round_trip ) {
+
+   vecmem::staging_pool pool( m_resource, 1000, 3 );
+   EXPECT_EQ( pool.slot_size(), 1000u );
+   EXPECT_EQ( pool.slot_count(), 3u );
+   EXPECT_EQ( m_resource.m_allocations, 1u );
+
+   for( std::size_t size : { 0ul, 1ul, 999ul, 1000ul, 2500ul, 3000ul,
+                             12345ul } ) {
+      std::vector< char > input( size );
+      for( std::size_t i = 0; i < size; ++i ) {
+         input[ i ] = static_cast< char >( i * 7 % 251 );
+      }
+      std::vector< char > device( size ), output( size );
+
+      deferred_transfer to_device( pool.slot_count() );
+      pool.to_device( size, input.data(), device.data(), to_device );
+      EXPECT_EQ( device, input );
+      EXPECT_EQ( to_device.m_starts, ( size + 999 ) / 1000 );
+
+      deferred_transfer to_host( pool.slot_count() );
+      pool.to_host( size, device.data(), output.data(), to_host );
+      EXPECT_EQ( output, input );
+      EXPECT_EQ( to_host.m_starts, ( size + 999 ) / 1000 );
+   }
+   // The slots should have been re-used, not re-allocated.
+   EXPECT_EQ( m_resource.m_allocations, 1u );
+}
+
+/// Test a pool with a single slot
+TEST_F( core_staging_pool_test, single_slot ) {
+
+   vecmem::staging_pool pool( m_resource, 64, 0 );
+   EXPECT_EQ( pool.slot_count(), 1u );
+
+   std::vector< int > input( 1000 ), device( 1000 ), output( 1000 );
+   for( std::size_t i = 0; i < input.size(); ++i ) {
+      input[ i ] = static_cast< int >( i );
+   }
+   deferred_transfer xfer( pool.slot_count() );
+   pool.to_device( input.size() * sizeof( int ), input.data(),
+                   device.data(), xfer );
+   pool.to_host( device.size() * sizeof( int ), device.data(),
+                 output.data(), xfer );
+   EXPECT_EQ( output, input );
+}
+
+/// Test that failed copies do not leave transfers running
+TEST_F( core_staging_pool_test, failure ) {
+
+   vecmem::staging_pool pool( m_resource, 100, 3 );
+   std::vector< char > input( 1000, 'a' ), output( 1000 );
+
+   for( std::size_t fail_at : { 1ul, 3ul, 5ul } ) {
+      deferred_transfer to_device( pool.slot_count() );
+      to_device.m_fail_at = fail_at;
+      EXPECT_THROW( pool.to_device( input.size(), input.data(),
+                                    output.data(), to_device ),
+                    std::runtime_error );
+      EXPECT_TRUE( to_device.idle() );
+
+      deferred_transfer to_host( pool.slot_count() );
+      to_host.m_fail_at = fail_at;
+      EXPECT_THROW( pool.to_host( input.size(), input.data(), output.data(),
+                                  to_host ),
+                    std::runtime_error );
+      EXPECT_TRUE( to_host.idle() );
+   }
+}
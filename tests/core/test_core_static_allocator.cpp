@@ -0,0 +1,75 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/static_resource_vector.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/memory/inline_host_memory_resource.hpp"
+#include "vecmem/memory/static_allocator.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+#include <numeric>
+#include <utility>
+
+/// Test the vectors using the inline host memory resource
+TEST( core_static_allocator_test, inline_resource ) {
+
+   // Vectors using the global instance of the resource.
+   vecmem::static_resource_vector< int,
+                                   vecmem::inline_host_memory_resource >
+      vec1( 100 );
+   std::iota( vec1.begin(), vec1.end(), 0 );
+   auto vec2 = vec1;
+   EXPECT_EQ( vec1, vec2 );
+   EXPECT_EQ( vec1.get_allocator(), vec2.get_allocator() );
+
+   // Vectors using a specific instance of the resource.
+   vecmem::inline_host_memory_resource resource;
+   vecmem::static_resource_vector< int,
+                                   vecmem::inline_host_memory_resource >
+      vec3( 10, 5, resource );
+   EXPECT_NE( vec1.get_allocator(), vec3.get_allocator() );
+   vec3 = std::move( vec1 );
+   EXPECT_EQ( vec3, vec2 );
+
+   // The vectors should work with the view types.
+   vecmem::device_vector< int > device( vecmem::get_data( vec3 ) );
+   ASSERT_EQ( device.size(), vec2.size() );
+   for( std::size_t i = 0; i < device.size(); ++i ) {
+      EXPECT_EQ( device[ i ], vec2[ i ] );
+   }
+
+   // Over-aligned allocations should work as well.
+   void* ptr = resource.allocate( 100, 256 );
+   EXPECT_EQ( reinterpret_cast< std::uintptr_t >( ptr ) % 256, 0u );
+   resource.deallocate( ptr, 100, 256 );
+
+   // The resource should also be usable through the virtual interface.
+   vecmem::memory_resource& base = resource;
+   EXPECT_TRUE( base.is_equal( vecmem::inline_host_memory_resource() ) );
+   EXPECT_FALSE( base.is_equal( vecmem::host_memory_resource() ) );
+   vecmem::vector< int > vec4( 10, &base );
+   EXPECT_EQ( vec4.size(), 10u );
+}
+
+/// Test the allocator with a "regular" memory resource
+TEST( core_static_allocator_test, polymorphic_resource ) {
+
+   vecmem::host_memory_resource resource;
+   vecmem::static_resource_default_init_vector< double,
+                                                vecmem::host_memory_resource >
+      vec( 100, resource );
+   std::iota( vec.begin(), vec.end(), 1.0 );
+   EXPECT_EQ( &( vec.get_allocator().resource() ), &resource );
+   EXPECT_EQ( vecmem::get_data( vec ).m_size, 100u );
+   EXPECT_EQ( vecmem::get_data( vec ).m_ptr, vec.data() );
+}
@@ -16,6 +16,7 @@
 #include <cmath>
 #include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 /// Test case for @c vecmem::static_vector
@@ -149,6 +150,18 @@ TYPED_TEST( core_static_vector_test, copy_constructor ) {
 
    // Check the copy.
    EXPECT_EQ_VEC( ref, copy );
+
+   // Move the copy into a new vector.
+   vecmem::static_vector< TypeParam, 100 > moved( std::move( copy ) );
+   EXPECT_EQ_VEC( ref, moved );
+   EXPECT_TRUE( copy.empty() );
+
+   // Assign the vector to existing ones.
+   vecmem::static_vector< TypeParam, 100 > assigned;
+   assigned = ref;
+   EXPECT_EQ_VEC( ref, assigned );
+   copy = std::move( assigned );
+   EXPECT_EQ_VEC( ref, copy );
 }
 
 /// Test the element access functions and operators
@@ -312,3 +325,45 @@ TEST_F( core_static_vector_test_complex, non_trivial_value ) {
    v.clear();
    EXPECT_EQ( dummy, 8 );
 }
+
+/// Test modifying a vector of elements that can not be moved with @c memmove
+TEST_F( core_static_vector_test_complex, non_trivial_modifications ) {
+
+   // Use strings that are long enough to be allocated on the heap.
+   const std::string s1( 50, 'a' ), s2( 50, 'b' ), s3( 50, 'c' );
+
+   // Create the test vector.
+   vecmem::static_vector< std::string, 20 > v( 3, s1 );
+   v.insert( v.begin() + 1, 2, s2 );
+   v.insert( v.begin(), s3 );
+   v.emplace( v.end(), s3 );
+   const std::vector< std::string > ref1 = { s3, s1, s2, s2, s1, s1, s3 };
+   ASSERT_EQ( v.size(), ref1.size() );
+   EXPECT_TRUE( std::equal( v.begin(), v.end(), ref1.begin() ) );
+
+   // Insert one of the vector's own elements.
+   v.insert( v.begin(), v.back() );
+   EXPECT_EQ( v.front(), s3 );
+
+   // Remove some elements.
+   v.erase( v.begin() );
+   v.erase( v.begin() + 1, v.begin() + 4 );
+   const std::vector< std::string > ref2 = { s3, s1, s1, s3 };
+   ASSERT_EQ( v.size(), ref2.size() );
+   EXPECT_TRUE( std::equal( v.begin(), v.end(), ref2.begin() ) );
+
+   // Copy and move the vector.
+   vecmem::static_vector< std::string, 20 > copy( v );
+   EXPECT_TRUE( std::equal( v.begin(), v.end(), copy.begin() ) );
+   vecmem::static_vector< std::string, 20 > moved( std::move( copy ) );
+   EXPECT_TRUE( copy.empty() );
+   EXPECT_TRUE( std::equal( v.begin(), v.end(), moved.begin() ) );
+   vecmem::static_vector< std::string, 20 > assigned( 10, s2 );
+   assigned = v;
+   EXPECT_TRUE( std::equal( v.begin(), v.end(), assigned.begin() ) );
+   assigned = std::move( moved );
+   EXPECT_TRUE( moved.empty() );
+   ASSERT_EQ( assigned.size(), ref2.size() );
+   EXPECT_TRUE( std::equal( assigned.begin(), assigned.end(),
+                            ref2.begin() ) );
+}
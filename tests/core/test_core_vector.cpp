@@ -12,6 +12,10 @@
 // GoogleTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <cstring>
+#include <string>
+
 /// Test case for @c vecmem::vector
 class core_vector_test : public testing::Test {
 
@@ -50,3 +54,78 @@ TEST_F( core_vector_test, constructor_destructor ) {
    }
    EXPECT_EQ( dummy, 4 );
 }
+
+namespace {
+
+   /// Memory resource handing out memory filled with a known pattern
+   class pattern_resource : public vecmem::memory_resource {
+
+   public:
+      /// The byte pattern used to fill new allocations
+      static constexpr unsigned char PATTERN = 0xab;
+
+   private:
+      void* do_allocate( std::size_t size, std::size_t alignment ) override {
+         void* result = m_upstream.allocate( size, alignment );
+         std::memset( result, PATTERN, size );
+         return result;
+      }
+      void do_deallocate( void* ptr, std::size_t size,
+                          std::size_t alignment ) override {
+         m_upstream.deallocate( ptr, size, alignment );
+      }
+      bool do_is_equal( const vecmem::memory_resource& other ) const
+         noexcept override {
+         return ( this == &other );
+      }
+
+      /// The resource performing the actual allocations
+      vecmem::host_memory_resource m_upstream;
+
+   }; // class pattern_resource
+
+} // private namespace
+
+/// Test @c vecmem::default_init_vector
+TEST_F( core_vector_test, default_init ) {
+
+   ::pattern_resource resource;
+
+   // Elements of trivial types must not be touched when resizing the vector.
+   vecmem::default_init_vector< unsigned char > vec1( 10, &resource );
+   vec1.reserve( 100 );
+   vec1.resize( 100 );
+   for( unsigned char c : vec1 ) {
+      EXPECT_EQ( c, ::pattern_resource::PATTERN );
+   }
+
+   // Explicitly provided values must still be used.
+   vecmem::default_init_vector< int > vec2( 10, 5, &resource );
+   vec2.resize( 20, 6 );
+   vec2.push_back( 7 );
+   EXPECT_EQ( vec2.front(), 5 );
+   EXPECT_EQ( vec2[ 15 ], 6 );
+   EXPECT_EQ( vec2.back(), 7 );
+   EXPECT_EQ( vec2.get_allocator().resource(), &resource );
+   const vecmem::default_init_vector< int > copy( vec2 );
+   EXPECT_EQ( copy, vec2 );
+
+   // Non-trivial types must still be constructed.
+   vecmem::default_init_vector< std::string > vec3( 3, &resource );
+   vec3.resize( 5 );
+   for( const std::string& str : vec3 ) {
+      EXPECT_TRUE( str.empty() );
+   }
+
+   // Allocator-aware elements must still receive the vector's resource.
+   vecmem::default_init_vector< vecmem::vector< int > > vec4( 2, &resource );
+   vec4.resize( 4 );
+   for( const vecmem::vector< int >& inner : vec4 ) {
+      EXPECT_EQ( inner.get_allocator().resource(), &resource );
+   }
+
+   // Views can be made of the vector like for the other vector types.
+   auto data = vecmem::get_data( vec2 );
+   EXPECT_EQ( data.m_size, vec2.size() );
+   EXPECT_EQ( data.m_ptr, vec2.data() );
+}
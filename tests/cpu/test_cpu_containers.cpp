@@ -0,0 +1,165 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/array.hpp"
+#include "vecmem/containers/const_device_array.hpp"
+#include "vecmem/containers/const_device_vector.hpp"
+#include "vecmem/containers/data/jagged_vector_data.hpp"
+#include "vecmem/containers/device_vector.hpp"
+#include "vecmem/containers/jagged_device_vector.hpp"
+#include "vecmem/containers/jagged_vector.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/cpu/device_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/cpu/copy.hpp"
+#include "vecmem/utils/cpu/launch.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+   /// "Kernel" performing a linear transformation
+   void linear_transform( std::size_t i,
+                          vecmem::data::vector_view< const int > constants,
+                          vecmem::data::vector_view< const int > input,
+                          vecmem::data::vector_view< int > output ) {
+
+      // Create the helper containers.
+      const vecmem::const_device_array< int, 2 > constantarray( constants );
+      const vecmem::const_device_vector< int > inputvec( input );
+      vecmem::device_vector< int > outputvec( output );
+
+      // Perform the linear transformation.
+      outputvec.at( i ) = inputvec.at( i ) * constantarray.at( 0 ) +
+                          constantarray.at( 1 );
+   }
+
+} // private namespace
+
+/// Test fixture for the "on-device" vecmem container tests
+class cpu_containers_test : public testing::Test {
+
+protected:
+   /// Host memory resource
+   vecmem::host_memory_resource m_host_resource;
+   /// "Device" memory resource
+   vecmem::cpu::device_memory_resource m_device_resource{ true };
+   /// Thread pool used in the tests
+   vecmem::thread_pool m_pool{ 4 };
+   /// Copy object used in the tests
+   vecmem::cpu::copy m_copy{ m_pool, 1024 };
+
+}; // class cpu_containers_test
+
+/// Test a linear transformation while hand-managing the memory copies
+TEST_F( cpu_containers_test, explicit_memory ) {
+
+   // Create input/output vectors on the host.
+   vecmem::vector< int > inputvec( 10000, &m_host_resource );
+   for( std::size_t i = 0; i < inputvec.size(); ++i ) {
+      inputvec[ i ] = static_cast< int >( i );
+   }
+   vecmem::vector< int > outputvec( inputvec.size(), &m_host_resource );
+   vecmem::array< int, 2 > constants( m_host_resource );
+   constants[ 0 ] = 2;
+   constants[ 1 ] = 3;
+
+   // Copy the inputs to the "device", and allocate the output there.
+   auto input_buffer =
+      m_copy.to( vecmem::get_data( std::as_const( inputvec ) ),
+                 m_device_resource, vecmem::copy::type::host_to_device );
+   auto constants_buffer =
+      m_copy.to( vecmem::get_data( std::as_const( constants ) ),
+                 m_device_resource, vecmem::copy::type::host_to_device );
+   vecmem::data::vector_buffer< int >
+      output_buffer( outputvec.size(), m_device_resource );
+
+   // Run the transformation.
+   vecmem::cpu::launch( m_pool, inputvec.size(), ::linear_transform,
+                        vecmem::data::vector_view< const int >(
+                           constants_buffer ),
+                        vecmem::data::vector_view< const int >(
+                           input_buffer ),
+                        vecmem::data::vector_view< int >( output_buffer ) );
+
+   // Copy the output back, and check it.
+   m_copy( output_buffer, vecmem::get_data( outputvec ),
+           vecmem::copy::type::device_to_host );
+   for( std::size_t i = 0; i < outputvec.size(); ++i ) {
+      EXPECT_EQ( outputvec[ i ], inputvec[ i ] * 2 + 3 );
+   }
+}
+
+/// Test launching kernels with lambdas
+TEST_F( cpu_containers_test, launch ) {
+
+   // Every index needs to be visited exactly once.
+   vecmem::vector< std::atomic< int > > visits( 12345, &m_host_resource );
+   vecmem::cpu::launch( visits.size(),
+                        [ &visits ]( std::size_t i ) { ++visits[ i ]; } );
+   for( const std::atomic< int >& v : visits ) {
+      EXPECT_EQ( v.load(), 1 );
+   }
+
+   // Empty launches are fine.
+   vecmem::cpu::launch( m_pool, 0, []( std::size_t ) {
+      throw std::runtime_error( "Should not be called" );
+   } );
+
+   // Exceptions are propagated to the caller.
+   EXPECT_THROW( vecmem::cpu::launch( m_pool, 100, []( std::size_t i ) {
+                    if( i == 42 ) {
+                       throw std::runtime_error( "test" );
+                    }
+                 } ),
+                 std::runtime_error );
+}
+
+/// Test copying a jagged vector to and from the "device"
+TEST_F( cpu_containers_test, jagged_copy ) {
+
+   // Create the input jagged vector.
+   vecmem::jagged_vector< int > input( &m_host_resource );
+   for( std::size_t i = 0; i < 20; ++i ) {
+      input.push_back( vecmem::vector< int >( i % 5, static_cast< int >( i ),
+                                              &m_host_resource ) );
+   }
+   vecmem::data::jagged_vector_data< int > input_data( input );
+
+   // Copy it to the "device", modify it there, and copy it back.
+   auto device_buffer = m_copy.to( input_data, m_device_resource,
+                                   vecmem::copy::type::host_to_device );
+   vecmem::cpu::launch( m_pool, device_buffer.m_size,
+                        []( std::size_t i,
+                            vecmem::data::jagged_vector_view< int > view ) {
+                           vecmem::jagged_device_vector< int > vec( view );
+                           for( int& value : vec.at( i ) ) {
+                              value *= 2;
+                           }
+                        },
+                        vecmem::data::jagged_vector_view< int >(
+                           device_buffer ) );
+   auto host_buffer = m_copy.to( device_buffer, m_host_resource,
+                                 vecmem::copy::type::device_to_host );
+
+   // Check the result.
+   vecmem::jagged_device_vector< int > output( host_buffer );
+   ASSERT_EQ( output.size(), input.size() );
+   for( std::size_t i = 0; i < input.size(); ++i ) {
+      ASSERT_EQ( output.at( i ).size(), input.at( i ).size() );
+      for( std::size_t j = 0; j < input.at( i ).size(); ++j ) {
+         EXPECT_EQ( output.at( i, j ), 2 * input.at( i ).at( j ) );
+      }
+   }
+}
@@ -0,0 +1,95 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/cpu/device_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "../common/memory_resource_name_gen.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+// Memory resources.
+static vecmem::cpu::device_memory_resource device_resource;
+static vecmem::cpu::device_memory_resource guarded_resource( true );
+
+/// Base test case for the CPU memory resources
+class cpu_memory_resource_test :
+   public testing::TestWithParam< vecmem::memory_resource* > {};
+
+/// Test allocations of different sizes and alignments
+TEST_P( cpu_memory_resource_test, allocations ) {
+
+   vecmem::memory_resource* resource = GetParam();
+   for( std::size_t size : { 0ul, 1ul, 7ul, 1000ul, 4096ul, 100001ul } ) {
+      for( std::size_t alignment : { 1ul, 8ul, 64ul, 4096ul } ) {
+         void* ptr = resource->allocate( size, alignment );
+         ASSERT_NE( ptr, nullptr );
+         EXPECT_EQ( reinterpret_cast< std::uintptr_t >( ptr ) % alignment,
+                    0u );
+         // The full block must be accessible.
+         std::memset( ptr, 0xab, size );
+         resource->deallocate( ptr, size, alignment );
+      }
+   }
+   EXPECT_THROW( static_cast< void >( resource->allocate( 100, 3 ) ),
+                 std::bad_alloc );
+}
+
+/// Test using the resources with a container
+TEST_P( cpu_memory_resource_test, vector ) {
+
+   vecmem::vector< int > vec( GetParam() );
+   for( int i = 0; i < 10000; ++i ) {
+      vec.push_back( i );
+   }
+   for( int i = 0; i < 10000; ++i ) {
+      EXPECT_EQ( vec[ i ], i );
+   }
+}
+
+// Instantiate the tests on all of the resources.
+INSTANTIATE_TEST_SUITE_P( cpu_memory_resource_tests, cpu_memory_resource_test,
+                          testing::Values( &device_resource,
+                                           &guarded_resource ),
+                          vecmem::testing::memory_resource_name_gen(
+                             { { &device_resource, "device_resource" },
+                               { &guarded_resource, "guarded_resource" } }
+                          ) );
+
+/// Test the equality of the resources
+TEST( cpu_memory_resource_misc, equality ) {
+
+   vecmem::cpu::device_memory_resource other;
+   vecmem::host_memory_resource host;
+   EXPECT_TRUE( device_resource.is_equal( other ) );
+   EXPECT_FALSE( device_resource.is_equal( guarded_resource ) );
+   EXPECT_FALSE( device_resource.is_equal( host ) );
+   EXPECT_TRUE( guarded_resource.guard_pages() );
+}
+
+/// Test that the guard pages catch out-of-bounds accesses
+TEST( cpu_memory_resource_misc, guard_pages ) {
+
+   ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+   EXPECT_DEATH( {
+      volatile char* ptr =
+         static_cast< char* >( guarded_resource.allocate( 100, 1 ) );
+      ptr[ 100 ] = 1;
+   }, "" );
+   EXPECT_DEATH( {
+      volatile char* ptr =
+         static_cast< char* >( guarded_resource.allocate( 8192, 1 ) );
+      ptr[ -1 ] = 1;
+   }, "" );
+}
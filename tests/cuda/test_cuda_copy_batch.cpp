@@ -0,0 +1,133 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/cuda/device_memory_resource.hpp"
+#include "vecmem/memory/cuda/host_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/copy_batch.hpp"
+#include "vecmem/utils/cuda/copy.hpp"
+#include "vecmem/utils/cuda/stream_wrapper.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/// Test fixture for the batched CUDA copies
+class cuda_copy_batch_test : public testing::Test {
+
+protected:
+   /// Set up the test data
+   void SetUp() override {
+
+      // Buffers with odd sizes, which are partly below and partly above the
+      // packing limit of the batch.
+      static const std::size_t sizes[] = { 1, 13, 255, 4097, 65535, 65536,
+                                           65537, 300001 };
+      for( std::size_t size : sizes ) {
+         vecmem::vector< unsigned char > input( size, &m_host_resource );
+         for( std::size_t i = 0; i < size; ++i ) {
+            input[ i ] = static_cast< unsigned char >( ( i * 31 + size ) &
+                                                       0xff );
+         }
+         m_inputs.push_back( std::move( input ) );
+      }
+   }
+
+   /// Copy a device buffer back to the host, with a single @c cudaMemcpy
+   vecmem::data::vector_buffer< unsigned char >
+   to_host( const vecmem::data::vector_view< unsigned char >& device ) {
+
+      return vecmem::cuda::copy_to_host( device, m_host_resource );
+   }
+
+   /// Plain host memory resource
+   vecmem::host_memory_resource m_host_resource;
+   /// Pinned host memory resource
+   vecmem::cuda::host_memory_resource m_pinned_resource;
+   /// Device memory resource
+   vecmem::cuda::device_memory_resource m_device_resource;
+   /// Stream to perform the batched copies on
+   vecmem::cuda::stream_wrapper m_stream;
+   /// The buffers to copy
+   std::vector< vecmem::vector< unsigned char > > m_inputs;
+
+}; // class cuda_copy_batch_test
+
+/// Test batched host-to-device copies
+TEST_F( cuda_copy_batch_test, host_to_device ) {
+
+   // Copy all buffers to the device in one batch.
+   std::vector< vecmem::data::vector_buffer< unsigned char > > targets;
+   vecmem::copy_batch batch;
+   for( vecmem::vector< unsigned char >& input : m_inputs ) {
+      targets.emplace_back( input.size(), m_device_resource );
+      batch.add( vecmem::get_data( input ),
+                 vecmem::data::vector_view< unsigned char >(
+                    targets.back() ) );
+   }
+   EXPECT_FALSE( batch.packed().empty() );
+   EXPECT_FALSE( batch.direct().empty() );
+   vecmem::cuda::copy( batch, m_pinned_resource, m_device_resource,
+                       vecmem::copy::type::host_to_device, m_stream );
+
+   // Compare the results with copying every buffer one by one.
+   for( std::size_t i = 0; i < m_inputs.size(); ++i ) {
+      const vecmem::data::vector_buffer< unsigned char > reference =
+         vecmem::cuda::copy_to_device( vecmem::get_data( m_inputs[ i ] ),
+                                       m_device_resource );
+      const vecmem::data::vector_buffer< unsigned char > expected =
+         to_host( reference );
+      const vecmem::data::vector_buffer< unsigned char > result =
+         to_host( targets[ i ] );
+      ASSERT_EQ( result.m_size, expected.m_size );
+      EXPECT_TRUE( std::equal( result.m_ptr, result.m_ptr + result.m_size,
+                               expected.m_ptr ) );
+      EXPECT_TRUE( std::equal( m_inputs[ i ].begin(), m_inputs[ i ].end(),
+                               result.m_ptr ) );
+   }
+}
+
+/// Test batched device-to-host copies
+TEST_F( cuda_copy_batch_test, device_to_host ) {
+
+   // Set up the buffers on the device one by one.
+   std::vector< vecmem::data::vector_buffer< unsigned char > > sources;
+   for( vecmem::vector< unsigned char >& input : m_inputs ) {
+      sources.push_back(
+         vecmem::cuda::copy_to_device( vecmem::get_data( input ),
+                                       m_device_resource ) );
+   }
+
+   // Copy all of them back to the host in one batch.
+   std::vector< vecmem::vector< unsigned char > > outputs;
+   vecmem::copy_batch batch;
+   for( std::size_t i = 0; i < sources.size(); ++i ) {
+      outputs.emplace_back( sources[ i ].m_size, 0, &m_host_resource );
+      batch.add( vecmem::data::vector_view< unsigned char >( sources[ i ] ),
+                 vecmem::get_data( outputs.back() ) );
+   }
+   vecmem::cuda::copy( batch, m_pinned_resource, m_device_resource,
+                       vecmem::copy::type::device_to_host, m_stream );
+
+   // Compare the results with copying every buffer one by one.
+   for( std::size_t i = 0; i < sources.size(); ++i ) {
+      const vecmem::data::vector_buffer< unsigned char > expected =
+         to_host( sources[ i ] );
+      ASSERT_EQ( outputs[ i ].size(), expected.m_size );
+      EXPECT_TRUE( std::equal( outputs[ i ].begin(), outputs[ i ].end(),
+                               expected.m_ptr ) );
+      EXPECT_EQ( outputs[ i ], m_inputs[ i ] );
+   }
+}
@@ -8,7 +8,10 @@
 
 #include "test_cuda_jagged_vector_view_kernels.cuh"
 
+#include "vecmem/memory/cuda/device_memory_resource.hpp"
 #include "vecmem/memory/cuda/managed_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/cuda/copy.hpp"
 #include "vecmem/containers/vector.hpp"
 #include "vecmem/containers/jagged_vector.hpp"
 #include "vecmem/containers/data/jagged_vector_data.hpp"
@@ -60,3 +63,21 @@ TEST_F(cuda_jagged_vector_view_test, mutate_in_kernel) {
     EXPECT_EQ(m_jag.at(5, 3), 30);
     EXPECT_EQ(m_jag.at(5, 4), 32);
 }
+
+TEST_F(cuda_jagged_vector_view_test, copy_to_device_and_back) {
+    vecmem::cuda::device_memory_resource device_mem;
+    vecmem::host_memory_resource host_mem;
+
+    auto device_data = vecmem::cuda::copy_to_device(m_data, device_mem);
+    doubleJagged(device_data);
+    auto host_data = vecmem::cuda::copy_to_host(device_data, host_mem);
+
+    vecmem::jagged_device_vector<int> m_jag(host_data);
+
+    EXPECT_EQ(m_jag.size(), 6);
+    EXPECT_EQ(m_jag.at(4).size(), 0);
+    EXPECT_EQ(m_jag.at(0, 0), 2);
+    EXPECT_EQ(m_jag.at(1, 1), 12);
+    EXPECT_EQ(m_jag.at(3, 0), 22);
+    EXPECT_EQ(m_jag.at(5, 4), 32);
+}
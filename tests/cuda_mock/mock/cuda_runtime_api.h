@@ -0,0 +1,104 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// System include(s).
+#include <cstddef>
+
+/// @file
+///
+/// Mock replacement for the CUDA runtime API header
+///
+/// It declares the (small) part of the CUDA runtime API that the sources of
+/// the @c vecmem::cuda library make use of. The functions are implemented
+/// on the host in @c mock_cuda_runtime.cpp, which allows the host side logic
+/// of the library to be tested on machines without a GPU.
+///
+
+/// Error codes returned by the mock runtime
+enum cudaError_t {
+   cudaSuccess = 0,
+   cudaErrorInvalidValue = 1,
+   cudaErrorMemoryAllocation = 2,
+   cudaErrorInvalidDevice = 101,
+   cudaErrorInvalidResourceHandle = 400
+};
+
+/// Memory copy directions
+enum cudaMemcpyKind {
+   cudaMemcpyHostToHost = 0,
+   cudaMemcpyHostToDevice = 1,
+   cudaMemcpyDeviceToHost = 2,
+   cudaMemcpyDeviceToDevice = 3,
+   cudaMemcpyDefault = 4
+};
+
+/// Opaque stream type
+struct CUstream_st;
+/// Stream handle type
+typedef CUstream_st* cudaStream_t;
+
+/// Opaque event type
+struct CUevent_st;
+/// Event handle type
+typedef CUevent_st* cudaEvent_t;
+
+/// Flag for creating events without timing information
+static constexpr unsigned int cudaEventDisableTiming = 0x02;
+
+/// Device identifier referring to the host
+static constexpr int cudaCpuDeviceId = -1;
+
+/// @name Error handling
+/// @{
+const char* cudaGetErrorString( cudaError_t error );
+/// @}
+
+/// @name Device management
+/// @{
+cudaError_t cudaGetDevice( int* device );
+cudaError_t cudaSetDevice( int device );
+/// @}
+
+/// @name Memory management
+/// @{
+cudaError_t cudaMalloc( void** ptr, std::size_t size );
+cudaError_t cudaFree( void* ptr );
+cudaError_t cudaMallocHost( void** ptr, std::size_t size );
+cudaError_t cudaFreeHost( void* ptr );
+cudaError_t cudaMallocAsync( void** ptr, std::size_t size,
+                             cudaStream_t stream );
+cudaError_t cudaFreeAsync( void* ptr, cudaStream_t stream );
+cudaError_t cudaMallocManaged( void** ptr, std::size_t size,
+                               unsigned int flags = 0x01 );
+cudaError_t cudaMemPrefetchAsync( const void* ptr, std::size_t count,
+                                  int device, cudaStream_t stream = 0 );
+/// @}
+
+/// @name Memory copies
+/// @{
+cudaError_t cudaMemcpy( void* dst, const void* src, std::size_t count,
+                        cudaMemcpyKind kind );
+cudaError_t cudaMemcpyAsync( void* dst, const void* src, std::size_t count,
+                             cudaMemcpyKind kind, cudaStream_t stream );
+/// @}
+
+/// @name Stream management
+/// @{
+cudaError_t cudaStreamCreate( cudaStream_t* stream );
+cudaError_t cudaStreamDestroy( cudaStream_t stream );
+cudaError_t cudaStreamSynchronize( cudaStream_t stream );
+/// @}
+
+/// @name Event management
+/// @{
+cudaError_t cudaEventCreateWithFlags( cudaEvent_t* event,
+                                      unsigned int flags );
+cudaError_t cudaEventDestroy( cudaEvent_t event );
+cudaError_t cudaEventRecord( cudaEvent_t event, cudaStream_t stream );
+cudaError_t cudaEventSynchronize( cudaEvent_t event );
+/// @}
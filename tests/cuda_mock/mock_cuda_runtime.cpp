@@ -0,0 +1,380 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "mock_cuda_runtime.hpp"
+
+// System include(s).
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <set>
+#include <vector>
+
+/// Mock CUDA stream, executing its operations when it gets synchronised
+struct CUstream_st {
+   /// The device that the stream was created for
+   int m_device;
+   /// Operations waiting for execution
+   std::vector< std::function< void() > > m_operations;
+}; // struct CUstream_st
+
+/// Mock CUDA event, remembering the stream that it was last recorded on
+struct CUevent_st {
+   /// The stream that the event was last recorded on
+   cudaStream_t m_stream;
+}; // struct CUevent_st
+
+namespace {
+
+   /// The statistics of the mock runtime
+   vecmem::testing::mock_cuda::statistics g_stats;
+   /// The error to return from the next failing call
+   cudaError_t g_next_error = cudaSuccess;
+   /// The number of calls to let succeed before failing with the error
+   std::size_t g_calls_before_error = 0;
+   /// The streams that are currently alive
+   std::set< cudaStream_t > g_streams;
+   /// The currently selected device of the thread
+   thread_local int t_device = 0;
+
+   /// Check whether the current call should fail
+   cudaError_t take_failure() {
+
+      if( ( g_next_error != cudaSuccess ) && ( g_calls_before_error > 0 ) ) {
+         --g_calls_before_error;
+         return cudaSuccess;
+      }
+      const cudaError_t result = g_next_error;
+      g_next_error = cudaSuccess;
+      return result;
+   }
+
+   /// Check whether a stream handle is valid
+   bool valid_stream( cudaStream_t stream ) {
+
+      return ( ( stream == nullptr ) ||
+               ( g_streams.find( stream ) != g_streams.end() ) );
+   }
+
+   /// Execute an operation on a stream
+   ///
+   /// Operations on the default stream are executed right away, operations
+   /// on other streams are only executed when the stream is synchronised.
+   ///
+   void enqueue( cudaStream_t stream, std::function< void() > operation ) {
+
+      if( stream == nullptr ) {
+         operation();
+      } else {
+         stream->m_operations.push_back( std::move( operation ) );
+      }
+   }
+
+   /// Allocate a memory block
+   cudaError_t allocate( void** ptr, std::size_t size ) {
+
+      if( ptr == nullptr ) {
+         return cudaErrorInvalidValue;
+      }
+      *ptr = std::malloc( size == 0 ? 1 : size );
+      if( *ptr == nullptr ) {
+         return cudaErrorMemoryAllocation;
+      }
+      ++( g_stats.m_live_allocations );
+      return cudaSuccess;
+   }
+
+   /// Free a memory block
+   void deallocate( void* ptr ) {
+
+      if( ptr != nullptr ) {
+         std::free( ptr );
+         --( g_stats.m_live_allocations );
+      }
+   }
+
+} // private namespace
+
+const char* cudaGetErrorString( cudaError_t error ) {
+
+   switch( error ) {
+   case cudaSuccess:
+      return "no error";
+   case cudaErrorInvalidValue:
+      return "invalid argument";
+   case cudaErrorMemoryAllocation:
+      return "out of memory";
+   case cudaErrorInvalidDevice:
+      return "invalid device ordinal";
+   case cudaErrorInvalidResourceHandle:
+      return "invalid resource handle";
+   }
+   return "unknown error";
+}
+
+cudaError_t cudaGetDevice( int* device ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   *device = t_device;
+   return cudaSuccess;
+}
+
+cudaError_t cudaSetDevice( int device ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   if( ( device < 0 ) ||
+       ( device >= vecmem::testing::mock_cuda::device_count ) ) {
+      return cudaErrorInvalidDevice;
+   }
+   t_device = device;
+   return cudaSuccess;
+}
+
+cudaError_t cudaMalloc( void** ptr, std::size_t size ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   return allocate( ptr, size );
+}
+
+cudaError_t cudaFree( void* ptr ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   deallocate( ptr );
+   return cudaSuccess;
+}
+
+cudaError_t cudaMallocHost( void** ptr, std::size_t size ) {
+
+   return cudaMalloc( ptr, size );
+}
+
+cudaError_t cudaFreeHost( void* ptr ) {
+
+   return cudaFree( ptr );
+}
+
+cudaError_t cudaMallocAsync( void** ptr, std::size_t size,
+                             cudaStream_t stream ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   if( valid_stream( stream ) == false ) {
+      return cudaErrorInvalidResourceHandle;
+   }
+   ++( g_stats.m_async_allocations );
+   return allocate( ptr, size );
+}
+
+cudaError_t cudaFreeAsync( void* ptr, cudaStream_t stream ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   if( valid_stream( stream ) == false ) {
+      return cudaErrorInvalidResourceHandle;
+   }
+   ++( g_stats.m_async_frees );
+   enqueue( stream, [ ptr ]() { deallocate( ptr ); } );
+   return cudaSuccess;
+}
+
+cudaError_t cudaMallocManaged( void** ptr, std::size_t size, unsigned int ) {
+
+   return cudaMalloc( ptr, size );
+}
+
+cudaError_t cudaMemPrefetchAsync( const void*, std::size_t, int device,
+                                  cudaStream_t stream ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   if( valid_stream( stream ) == false ) {
+      return cudaErrorInvalidResourceHandle;
+   }
+   if( ( device != cudaCpuDeviceId ) &&
+       ( ( device < 0 ) ||
+         ( device >= vecmem::testing::mock_cuda::device_count ) ) ) {
+      return cudaErrorInvalidDevice;
+   }
+   ++( g_stats.m_prefetches );
+   g_stats.m_last_prefetch_device = device;
+   return cudaSuccess;
+}
+
+cudaError_t cudaMemcpy( void* dst, const void* src, std::size_t count,
+                        cudaMemcpyKind ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   ++( g_stats.m_sync_copies );
+   if( count != 0 ) {
+      std::memcpy( dst, src, count );
+   }
+   return cudaSuccess;
+}
+
+cudaError_t cudaMemcpyAsync( void* dst, const void* src, std::size_t count,
+                             cudaMemcpyKind, cudaStream_t stream ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   if( valid_stream( stream ) == false ) {
+      return cudaErrorInvalidResourceHandle;
+   }
+   ++( g_stats.m_async_copies );
+   enqueue( stream, [ dst, src, count ]() {
+      if( count != 0 ) {
+         std::memcpy( dst, src, count );
+      }
+   } );
+   return cudaSuccess;
+}
+
+cudaError_t cudaStreamCreate( cudaStream_t* stream ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   *stream = new CUstream_st{ t_device, {} };
+   g_streams.insert( *stream );
+   ++( g_stats.m_live_streams );
+   return cudaSuccess;
+}
+
+cudaError_t cudaStreamDestroy( cudaStream_t stream ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   if( ( stream == nullptr ) ||
+       ( g_streams.find( stream ) == g_streams.end() ) ) {
+      return cudaErrorInvalidResourceHandle;
+   }
+   // Like the real runtime, finish the pending work first.
+   for( const std::function< void() >& operation : stream->m_operations ) {
+      operation();
+   }
+   g_streams.erase( stream );
+   delete stream;
+   --( g_stats.m_live_streams );
+   return cudaSuccess;
+}
+
+cudaError_t cudaStreamSynchronize( cudaStream_t stream ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   if( valid_stream( stream ) == false ) {
+      return cudaErrorInvalidResourceHandle;
+   }
+   ++( g_stats.m_stream_syncs );
+   if( stream != nullptr ) {
+      for( const std::function< void() >& operation : stream->m_operations ) {
+         operation();
+      }
+      stream->m_operations.clear();
+   }
+   return cudaSuccess;
+}
+
+cudaError_t cudaEventCreateWithFlags( cudaEvent_t* event, unsigned int ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   *event = new CUevent_st{ nullptr };
+   ++( g_stats.m_live_events );
+   return cudaSuccess;
+}
+
+cudaError_t cudaEventDestroy( cudaEvent_t event ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   if( event == nullptr ) {
+      return cudaErrorInvalidResourceHandle;
+   }
+   delete event;
+   --( g_stats.m_live_events );
+   return cudaSuccess;
+}
+
+cudaError_t cudaEventRecord( cudaEvent_t event, cudaStream_t stream ) {
+
+   if( cudaError_t error = take_failure() ) {
+      return error;
+   }
+   if( ( event == nullptr ) || ( valid_stream( stream ) == false ) ) {
+      return cudaErrorInvalidResourceHandle;
+   }
+   event->m_stream = stream;
+   return cudaSuccess;
+}
+
+cudaError_t cudaEventSynchronize( cudaEvent_t event ) {
+
+   if( event == nullptr ) {
+      return cudaErrorInvalidResourceHandle;
+   }
+   // Simply wait for everything scheduled on the stream so far. Which is
+   // a (valid) over-synchronisation.
+   return cudaStreamSynchronize( event->m_stream );
+}
+
+namespace vecmem::testing::mock_cuda {
+
+   statistics& stats() {
+
+      return g_stats;
+   }
+
+   void reset() {
+
+      g_stats.m_sync_copies = 0;
+      g_stats.m_async_copies = 0;
+      g_stats.m_stream_syncs = 0;
+      g_stats.m_async_allocations = 0;
+      g_stats.m_async_frees = 0;
+      g_stats.m_prefetches = 0;
+      g_stats.m_last_prefetch_device = 0;
+      g_next_error = cudaSuccess;
+      g_calls_before_error = 0;
+      t_device = 0;
+   }
+
+   void fail_next_call( cudaError_t error, std::size_t skip ) {
+
+      g_next_error = error;
+      g_calls_before_error = skip;
+   }
+
+   std::size_t pending_operations( cudaStream_t stream ) {
+
+      return ( stream == nullptr ? 0 : stream->m_operations.size() );
+   }
+
+   int stream_device( cudaStream_t stream ) {
+
+      return ( stream == nullptr ? t_device : stream->m_device );
+   }
+
+} // namespace vecmem::testing::mock_cuda
@@ -0,0 +1,63 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+#pragma once
+
+// Mock CUDA include(s).
+#include <cuda_runtime_api.h>
+
+// System include(s).
+#include <cstddef>
+
+namespace vecmem::testing::mock_cuda {
+
+   /// The number of devices "available" in the mock runtime
+   static constexpr int device_count = 2;
+
+   /// Statistics collected by the mock runtime
+   struct statistics {
+      /// Number of synchronous memory copies
+      std::size_t m_sync_copies = 0;
+      /// Number of memory copies scheduled on a stream
+      std::size_t m_async_copies = 0;
+      /// Number of prefetches scheduled on a stream
+      std::size_t m_prefetches = 0;
+      /// The device that the last prefetch targeted
+      int m_last_prefetch_device = 0;
+      /// Number of stream synchronisations
+      std::size_t m_stream_syncs = 0;
+      /// Number of stream ordered allocations
+      std::size_t m_async_allocations = 0;
+      /// Number of stream ordered deallocations
+      std::size_t m_async_frees = 0;
+      /// Number of streams that were created, but not destroyed yet
+      std::size_t m_live_streams = 0;
+      /// Number of events that were created, but not destroyed yet
+      std::size_t m_live_events = 0;
+      /// Number of memory blocks that were allocated, but not freed yet
+      std::size_t m_live_allocations = 0;
+   }; // struct statistics
+
+   /// Access the statistics of the mock runtime
+   statistics& stats();
+
+   /// Reset the state of the mock runtime
+   void reset();
+
+   /// Make the next call to the mock runtime fail with a given error
+   ///
+   /// @param error The error to fail the call with
+   /// @param skip The number of calls to let succeed before the failing one
+   ///
+   void fail_next_call( cudaError_t error, std::size_t skip = 0 );
+
+   /// Get the number of operations waiting for execution on a stream
+   std::size_t pending_operations( cudaStream_t stream );
+
+   /// Get the device that a stream was created for
+   int stream_device( cudaStream_t stream );
+
+} // namespace vecmem::testing::mock_cuda
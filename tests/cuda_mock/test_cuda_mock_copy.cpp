@@ -0,0 +1,223 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/cuda/async_device_memory_resource.hpp"
+#include "vecmem/memory/cuda/device_memory_resource.hpp"
+#include "vecmem/memory/cuda/host_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/cuda/copy.hpp"
+#include "vecmem/utils/cuda/stream_wrapper.hpp"
+#include "vecmem/utils/staging_pool.hpp"
+#include "mock_cuda_runtime.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace mock = vecmem::testing::mock_cuda;
+
+/// Test fixture for the CUDA library, running on the mock runtime
+class cuda_mock_test : public testing::Test {
+
+protected:
+   /// Reset the mock runtime before every test
+   void SetUp() override {
+      mock::reset();
+   }
+   /// Make sure that no resources were leaked by the test
+   void TearDown() override {
+      EXPECT_EQ( mock::stats().m_live_streams, 0u );
+      EXPECT_EQ( mock::stats().m_live_events, 0u );
+      EXPECT_EQ( mock::stats().m_live_allocations, 0u );
+   }
+
+   /// Host memory resource used in the tests
+   vecmem::host_memory_resource m_host_resource;
+
+}; // class cuda_mock_test
+
+/// Test the lifetime management of @c vecmem::cuda::stream_wrapper
+TEST_F( cuda_mock_test, stream_wrapper ) {
+
+   {
+      // Create streams on different devices.
+      vecmem::cuda::stream_wrapper stream1;
+      vecmem::cuda::stream_wrapper stream2( 1 );
+      EXPECT_EQ( mock::stats().m_live_streams, 2u );
+      EXPECT_EQ( mock::stream_device(
+                    static_cast< cudaStream_t >( stream1.stream() ) ), 0 );
+      EXPECT_EQ( mock::stream_device(
+                    static_cast< cudaStream_t >( stream2.stream() ) ), 1 );
+
+      // Copies share the stream of their parent.
+      vecmem::cuda::stream_wrapper copy( stream1 );
+      EXPECT_EQ( copy.stream(), stream1.stream() );
+      copy = stream2;
+      EXPECT_EQ( copy.stream(), stream2.stream() );
+      vecmem::cuda::stream_wrapper moved( std::move( copy ) );
+      EXPECT_EQ( moved.stream(), stream2.stream() );
+      EXPECT_EQ( mock::stats().m_live_streams, 2u );
+
+      // Non-owning wrappers don't manage the lifetime of the stream.
+      {
+         vecmem::cuda::stream_wrapper view( stream1.stream() );
+         view.synchronize();
+      }
+      EXPECT_EQ( mock::stats().m_live_streams, 2u );
+      EXPECT_EQ( mock::stats().m_stream_syncs, 1u );
+   }
+   EXPECT_EQ( mock::stats().m_live_streams, 0u );
+
+   // Errors from the runtime are turned into exceptions.
+   EXPECT_THROW( vecmem::cuda::stream_wrapper( 5 ), std::runtime_error );
+   mock::fail_next_call( cudaErrorInvalidValue );
+   EXPECT_THROW( vecmem::cuda::stream_wrapper(), std::runtime_error );
+}
+
+/// Test the stream ordered copy functions
+TEST_F( cuda_mock_test, async_copy ) {
+
+   vecmem::cuda::stream_wrapper stream;
+   cudaStream_t cuda_stream = static_cast< cudaStream_t >( stream.stream() );
+   vecmem::cuda::device_memory_resource device_resource;
+
+   const vecmem::vector< int > input( { 1, 2, 3, 4, 5 }, &m_host_resource );
+   {
+      // Schedule a round trip of the data.
+      vecmem::data::vector_buffer< int > device =
+         vecmem::cuda::copy_to_device( vecmem::get_data( input ),
+                                       device_resource, stream );
+      vecmem::data::vector_buffer< int > host =
+         vecmem::cuda::copy_to_host(
+            vecmem::data::vector_view< int >( device ), m_host_resource,
+            stream );
+      vecmem::vector< int > output( input.size(), &m_host_resource );
+      vecmem::data::vector_view< int > output_data =
+         vecmem::get_data( output );
+      vecmem::cuda::copy( vecmem::data::vector_view< int >( host ),
+                          output_data, stream );
+
+      // None of the copies should have happened yet.
+      EXPECT_EQ( mock::stats().m_async_copies, 3u );
+      EXPECT_EQ( mock::stats().m_sync_copies, 0u );
+      EXPECT_EQ( mock::pending_operations( cuda_stream ), 3u );
+      EXPECT_FALSE( std::equal( input.begin(), input.end(),
+                                output.begin() ) );
+
+      // But they should all be done after synchronising the stream.
+      stream.synchronize();
+      EXPECT_EQ( mock::pending_operations( cuda_stream ), 0u );
+      EXPECT_TRUE( std::equal( input.begin(), input.end(),
+                               output.begin() ) );
+   }
+
+   // The synchronous functions should still be synchronous.
+   vecmem::vector< int > input2 = input;
+   vecmem::data::vector_buffer< int > device =
+      vecmem::cuda::copy_to_device( vecmem::get_data( input2 ),
+                                    device_resource );
+   EXPECT_EQ( mock::stats().m_sync_copies, 1u );
+   EXPECT_TRUE( std::equal( input.begin(), input.end(), device.m_ptr ) );
+
+   // Errors are reported right away.
+   mock::fail_next_call( cudaErrorInvalidValue );
+   EXPECT_THROW( vecmem::cuda::copy_to_device( vecmem::get_data( input ),
+                                               device_resource, stream ),
+                 std::runtime_error );
+}
+
+/// Test @c vecmem::cuda::async_device_memory_resource
+TEST_F( cuda_mock_test, async_device_memory_resource ) {
+
+   vecmem::cuda::stream_wrapper stream;
+   cudaStream_t cuda_stream = static_cast< cudaStream_t >( stream.stream() );
+   {
+      vecmem::cuda::async_device_memory_resource resource( stream );
+      EXPECT_EQ( resource.stream().stream(), stream.stream() );
+
+      // Allocate and release a buffer.
+      {
+         vecmem::data::vector_buffer< float > buffer( 100, resource );
+         EXPECT_EQ( mock::stats().m_async_allocations, 1u );
+      }
+      EXPECT_EQ( mock::stats().m_async_frees, 1u );
+
+      // The memory is only released once the stream gets there.
+      EXPECT_EQ( mock::pending_operations( cuda_stream ), 1u );
+      EXPECT_EQ( mock::stats().m_live_allocations, 1u );
+      stream.synchronize();
+      EXPECT_EQ( mock::stats().m_live_allocations, 0u );
+
+      // Check the equality of the resources.
+      vecmem::cuda::async_device_memory_resource same( stream );
+      vecmem::cuda::stream_wrapper other_stream;
+      vecmem::cuda::async_device_memory_resource other( other_stream );
+      EXPECT_TRUE( resource.is_equal( same ) );
+      EXPECT_FALSE( resource.is_equal( other ) );
+   }
+   // The resource keeps its stream alive.
+   {
+      vecmem::cuda::async_device_memory_resource resource{
+         vecmem::cuda::stream_wrapper() };
+      EXPECT_EQ( mock::stats().m_live_streams, 2u );
+   }
+   EXPECT_EQ( mock::stats().m_live_streams, 1u );
+}
+
+/// Test the copies going through a staging pool
+TEST_F( cuda_mock_test, staged_copy ) {
+
+   vecmem::cuda::stream_wrapper stream;
+   vecmem::cuda::device_memory_resource device_resource;
+   vecmem::cuda::host_memory_resource pinned_resource;
+   vecmem::staging_pool staging( pinned_resource, 1024, 2 );
+
+   // Set up a vector that needs to be split into multiple chunks.
+   vecmem::vector< int > input( 10000, &m_host_resource );
+   for( std::size_t i = 0; i < input.size(); ++i ) {
+      input[ i ] = static_cast< int >( i * 3 );
+   }
+   const std::size_t chunks =
+      ( input.size() * sizeof( int ) + 1023 ) / 1024;
+
+   // Copy it to the device and back.
+   vecmem::data::vector_buffer< int > device =
+      vecmem::cuda::copy_to_device( vecmem::get_data( input ),
+                                    device_resource, staging, stream );
+   EXPECT_EQ( mock::stats().m_async_copies, chunks );
+   EXPECT_TRUE( std::equal( input.begin(), input.end(), device.m_ptr ) );
+   vecmem::data::vector_buffer< int > host =
+      vecmem::cuda::copy_to_host( vecmem::data::vector_view< int >( device ),
+                                  m_host_resource, staging, stream );
+   EXPECT_EQ( mock::stats().m_async_copies, 2 * chunks );
+   EXPECT_EQ( mock::stats().m_sync_copies, 0u );
+   EXPECT_TRUE( std::equal( input.begin(), input.end(), host.m_ptr ) );
+}
+
+/// Test that a failure to set up the staged copy does not leak events
+TEST_F( cuda_mock_test, staged_copy_failure ) {
+
+   vecmem::cuda::stream_wrapper stream;
+   vecmem::staging_pool staging( m_host_resource, 1024, 4 );
+   vecmem::vector< int > input( 1000, 1, &m_host_resource );
+
+   // Let the creation of the third event fail. The events created before it
+   // are checked by the fixture to have been destroyed.
+   mock::fail_next_call( cudaErrorMemoryAllocation, 2 );
+   EXPECT_THROW( vecmem::cuda::copy_to_device( vecmem::get_data( input ),
+                                               m_host_resource, staging,
+                                               stream ),
+                 std::runtime_error );
+   EXPECT_EQ( mock::stats().m_live_events, 0u );
+}
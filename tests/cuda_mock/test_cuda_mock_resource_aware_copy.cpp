@@ -0,0 +1,140 @@
+/** VecMem project, part of the ACTS project (R&D line)
+ *
+ * (c) 2021 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "vecmem/containers/data/vector_buffer.hpp"
+#include "vecmem/containers/vector.hpp"
+#include "vecmem/memory/binary_page_memory_resource.hpp"
+#include "vecmem/memory/cuda/device_memory_resource.hpp"
+#include "vecmem/memory/cuda/host_memory_resource.hpp"
+#include "vecmem/memory/cuda/managed_memory_resource.hpp"
+#include "vecmem/memory/host_memory_resource.hpp"
+#include "vecmem/utils/cuda/resource_aware_copy.hpp"
+#include "mock_cuda_runtime.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+
+namespace mock = vecmem::testing::mock_cuda;
+
+/// Test fixture for @c vecmem::cuda::resource_aware_copy
+class cuda_mock_resource_aware_copy_test : public testing::Test {
+
+protected:
+   /// Reset the mock runtime before every test
+   void SetUp() override {
+      mock::reset();
+   }
+
+   /// Host memory resource
+   vecmem::host_memory_resource m_host_resource;
+   /// Pinned host memory resource
+   vecmem::cuda::host_memory_resource m_pinned_resource;
+   /// Device memory resource
+   vecmem::cuda::device_memory_resource m_device_resource;
+   /// Managed memory resource
+   vecmem::cuda::managed_memory_resource m_managed_resource;
+
+}; // class cuda_mock_resource_aware_copy_test
+
+/// Test the recognition of the memory resources
+TEST_F( cuda_mock_resource_aware_copy_test, kinds ) {
+
+   vecmem::cuda::stream_wrapper stream;
+   vecmem::cuda::resource_aware_copy copy( stream );
+   EXPECT_EQ( copy.kind( m_host_resource ), vecmem::memory_kind::host );
+   EXPECT_EQ( copy.kind( m_pinned_resource ),
+              vecmem::memory_kind::pinned_host );
+   EXPECT_EQ( copy.kind( m_device_resource ), vecmem::memory_kind::device );
+   EXPECT_EQ( copy.kind( m_managed_resource ),
+              vecmem::memory_kind::managed );
+
+   // Resources built on top of others need to be described explicitly.
+   vecmem::binary_page_memory_resource cache( m_device_resource );
+   EXPECT_EQ( copy.kind( cache ), vecmem::memory_kind::unknown );
+   copy.set_kind( cache, vecmem::memory_kind::device );
+   EXPECT_EQ( copy.kind( cache ), vecmem::memory_kind::device );
+}
+
+/// Test the different copy paths
+TEST_F( cuda_mock_resource_aware_copy_test, copies ) {
+
+   vecmem::cuda::stream_wrapper stream;
+   vecmem::staging_pool staging( m_pinned_resource, 256, 2 );
+   vecmem::cuda::resource_aware_copy copy( stream, &staging, 1024 );
+
+   // Set up the test data.
+   vecmem::vector< int > host( 1000, &m_host_resource );
+   for( std::size_t i = 0; i < host.size(); ++i ) {
+      host[ i ] = static_cast< int >( i );
+   }
+   vecmem::vector< int > pinned( host.size(), &m_pinned_resource );
+   vecmem::data::vector_buffer< int > device( host.size(),
+                                              m_device_resource );
+   vecmem::vector< int > managed( host.size(), &m_managed_resource );
+
+   // Host to host copies are done with memcpy.
+   EXPECT_EQ( copy( vecmem::get_data( host ), m_host_resource,
+                    vecmem::get_data( pinned ), m_pinned_resource ).m_action,
+              vecmem::copy_decision::host_copy );
+   EXPECT_EQ( pinned, host );
+   EXPECT_EQ( mock::stats().m_async_copies, 0u );
+
+   // Pinned to device copies go directly.
+   EXPECT_EQ( copy( vecmem::get_data( pinned ), m_pinned_resource,
+                    vecmem::data::vector_view< int >( device ),
+                    m_device_resource ).m_action,
+              vecmem::copy_decision::runtime_copy );
+   EXPECT_EQ( mock::stats().m_async_copies, 1u );
+   EXPECT_TRUE( std::equal( host.begin(), host.end(), device.m_ptr ) );
+
+   // Copies involving managed memory are left to the runtime, unless they
+   // are not needed at all.
+   EXPECT_EQ( copy( vecmem::data::vector_view< int >( device ),
+                    m_device_resource, vecmem::get_data( managed ),
+                    m_managed_resource ).m_action,
+              vecmem::copy_decision::runtime_copy );
+   EXPECT_EQ( copy( vecmem::get_data( managed ), m_managed_resource,
+                    vecmem::get_data( managed ), m_managed_resource ).m_action,
+              vecmem::copy_decision::skip );
+
+   // Large pageable to/from device copies go through staging.
+   vecmem::vector< int > output( host.size(), 0, &m_host_resource );
+   mock::reset();
+   EXPECT_EQ( copy( vecmem::data::vector_view< int >( device ),
+                    m_device_resource, vecmem::get_data( output ),
+                    m_host_resource ).m_action,
+              vecmem::copy_decision::staged_copy );
+   EXPECT_EQ( mock::stats().m_async_copies,
+              ( host.size() * sizeof( int ) + 255 ) / 256 );
+   EXPECT_EQ( output, host );
+   EXPECT_EQ( managed, host );
+}
+
+/// Test prefetching managed memory
+TEST_F( cuda_mock_resource_aware_copy_test, prefetch ) {
+
+   vecmem::cuda::stream_wrapper stream;
+   vecmem::cuda::resource_aware_copy copy( stream );
+   vecmem::vector< float > managed( 100, &m_managed_resource );
+
+   // "Copy" the managed vector to the device and back.
+   auto decision = copy( vecmem::get_data( managed ), m_managed_resource,
+                         vecmem::get_data( managed ), m_device_resource );
+   EXPECT_EQ( decision.m_action, vecmem::copy_decision::prefetch );
+   EXPECT_EQ( mock::stats().m_prefetches, 1u );
+   EXPECT_EQ( mock::stats().m_last_prefetch_device, 0 );
+   decision = copy( vecmem::get_data( managed ), m_managed_resource,
+                    vecmem::get_data( managed ), m_host_resource );
+   EXPECT_EQ( decision.m_action, vecmem::copy_decision::prefetch );
+   EXPECT_EQ( mock::stats().m_prefetches, 2u );
+   EXPECT_EQ( mock::stats().m_last_prefetch_device, cudaCpuDeviceId );
+   EXPECT_EQ( mock::stats().m_async_copies, 0u );
+}